@@ -21,26 +21,26 @@ REBOL [
 
 add: action [
 	{Returns the addition of two values.}
-	value1 [any-scalar! date!]
+	value1 [any-scalar! date! vector!]
 	value2
 ]
 
 subtract: action [
 	{Returns the second value subtracted from the first.}
-	value1 [any-scalar! date!]
-	value2 [any-scalar! date!]
+	value1 [any-scalar! date! vector!]
+	value2 [any-scalar! date! vector!]
 ]
 
 multiply: action [
 	{Returns the first value multiplied by the second.}
-	value1 [any-scalar!]
-	value2 [any-scalar!]
+	value1 [any-scalar! vector!]
+	value2 [any-scalar! vector!]
 ]
 
 divide: action [
 	{Returns the first value divided by the second.}
-	value1 [any-scalar!]
-	value2 [any-scalar!]
+	value1 [any-scalar! vector!]
+	value2 [any-scalar! vector!]
 ]
 
 remainder: action [
@@ -208,6 +208,7 @@ find: action [
 	/reverse {Backwards from the current position}
 	/tail {Returns the end of the series}
 	/match {Performs comparison and returns the tail of the match}
+	/sorted {Series is in ascending order (searched by halves)}
 ]
 
 select: action [
@@ -292,9 +293,11 @@ append: action [
 
 remove: action [
 	{Removes element(s); returns same position.}
-	series [any-series! gob! port! bitset! none!] {At position (modified)}
+	series [any-series! map! gob! port! bitset! none!] {At position (modified)}
 	/part {Removes multiple elements or to a given position}
 	limit [any-number! any-series! pair! char!]
+	/key {Removes a key from a map}
+	key-arg [any-type!]
 ]
 
 change: action [
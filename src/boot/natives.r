@@ -392,7 +392,8 @@ compress: native [
 	{Compresses a string series and returns it.}
 	data [binary! string!] {If string, it will be UTF8 encoded}
 	/part limit {Length of data (elements)}
-	/gzip {Use GZIP checksum}
+	/gzip {Use GZIP format (for DECOMPRESS/GZIP or gzip tools)}
+	/level lvl [integer!] {Compression level from 0 (none) to 9 (best)}
 ]
 
 ;-- !!! This used to use /PART LENGTH, but when LENGTH? was migrate to LENGTH
@@ -404,10 +405,21 @@ decompress: native [
 	{Decompresses data. Result is binary.}
 	data [binary!] {Data to decompress}
 	/part lim {Length of compressed data (must match end marker)}
-	/gzip {Use GZIP checksum}
+	/gzip {Data is in GZIP format}
 	/limit size {Error out if result is larger than this}
 ]
 
+serialize: native [
+	{Encodes a value (and all it refers to) as binary, for DESERIALIZE.}
+	value [any-type!]
+]
+
+deserialize: native [
+	{Decodes binary made by SERIALIZE, without scanning.}
+	data [binary!] {Data to decode}
+	/part limit {Length of data}
+]
+
 construct: native [
 	{Creates an object with scant (safe) evaluation.}
 	block [block! string! binary!] "Specification (modified)"
@@ -662,6 +674,7 @@ transcode: native [
 	/next "Translate next complete value (blocks as single value)"
 	/only "Translate only a single value (blocks dissected)"
 	/error "Do not cause errors - return error object as value in place"
+	/partial {More source may follow: a value (or error) reaching the end is not returned, and the source is not advanced past it}
 ]
 
 echo: native [
@@ -912,6 +925,7 @@ stats: native [
 	/timer {High resolution time difference from start}
 	/evals {Number of values evaluated by interpreter}
 	/dump-series pool-id [integer!] {Dump all series in pool pool-id, -1 for all pools}
+	/pools {Block of [width used total segments hits misses] for each memory pool}
 ]
 
 do-codec: native [
@@ -1060,6 +1074,23 @@ maximum: native [ ; Note: Some datatypes expect all binary ops to be <= this
 	value2 [any-scalar! date! any-series!]
 ]
 
+sum-of: native [
+	{Returns the sum of the numbers in a vector.}
+	vector [vector!]
+]
+
+dot-product: native [
+	{Returns the sum of the products of two vectors' numbers.}
+	vector1 [vector!]
+	vector2 [vector!] {Must be the same length}
+]
+
+extreme-of: native [
+	{Returns the vector at its smallest (or largest) number.}
+	vector [vector!]
+	/largest {Find the largest number}
+]
+
 negative?: native [
 	{Returns TRUE if the number is negative.}
 	number [any-number! money! time! pair!]
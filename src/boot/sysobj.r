@@ -251,6 +251,13 @@ standard: context [
 		mask: [all]
 	]
 
+	port-spec-zlib: make port-spec-head [
+		mode: 'inflate ; or 'deflate
+		format: 'zlib ; or 'gzip, or 'deflate (raw)
+		level: none ; 0 to 9 when deflating
+		source: none ; port to READ the input from
+	]
+
 	file-info: context [
 		name:
 		size:
@@ -290,6 +297,9 @@ standard: context [
 		made-blocks:
 		made-objects:
 		recycles:
+		recycle-time:	; total time paused in GC
+		recycle-max:	; longest GC pause
+		recycle-last:	; most recent GC pause
 			none
 	]
 
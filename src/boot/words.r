@@ -187,6 +187,12 @@ udp
 clipboard
 serial
 signal
+zlib
+
+; Compression
+inflate
+deflate
+gzip
 
 ; Serial parameters
 ; Parity
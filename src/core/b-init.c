@@ -175,9 +175,25 @@ static	BOOT_BLK *Boot_Block;
 **		only be called at the correct point because it will
 **		create new symbols.
 **
+**		If make-boot.r was able to pre-scan the boot block, it is
+**		decoded from Boot_Image instead.  That skips inflating and
+**		scanning the text, and the image is read in place from the
+**		executable (the OS maps it in and shares it among processes).
+**
 ***********************************************************************/
 {
 	REBSER *boot;
+
+#if BOOT_IMAGE_SIZE > 0
+	REBVAL image;
+
+	// (Boot_Image array is in b-boot.c, auto-generated by make-boot.r.
+	// The symbols are created in the same order scanning would have.)
+
+	Deserialize_Value(&image, Boot_Image, BOOT_IMAGE_SIZE);
+	if (!IS_BLOCK(&image)) panic Error_0(RE_BOOT_DATA);
+	boot = VAL_SERIES(&image);
+#else
 	REBSER *text;
 
 	// Decompress binary data in Native_Specs to get the textual source
@@ -194,6 +210,7 @@ static	BOOT_BLK *Boot_Block;
 
 	boot = Scan_Source(STR_HEAD(text), NAT_UNCOMPRESSED_SIZE);
 	Free_Series(text);
+#endif
 
 	Set_Root_Series(ROOT_BOOT, boot, "boot block");	// Do not let it get GC'd
 
@@ -1296,7 +1313,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	// Run Recycle, but the TRUE flag indicates we want every series
 	// that is managed to be freed.  (Only unmanaged should be left.)
 	//
-	Recycle_Core(TRUE);
+	Recycle_Core(TRUE, FALSE);
 
 	FREE_ARRAY(REBYTE*, RS_MAX, PG_Boot_Strs);
 
@@ -1305,6 +1322,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	Shutdown_CRC();
 	Shutdown_Mold();
 	Shutdown_Scanner();
+	Shutdown_Parse();
 	Shutdown_Char_Cases();
 	Shutdown_GC();
 
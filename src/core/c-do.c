@@ -443,7 +443,7 @@ void Trace_Arg(REBINT num, const REBVAL *arg, const REBVAL *path)
 	// Check for recycle signal:
 	if (GET_FLAG(sigs, SIG_RECYCLE)) {
 		CLR_SIGNAL(SIG_RECYCLE);
-		Recycle();
+		Recycle_Core(FALSE, TRUE); // series pool is swept as it's reused
 	}
 
 #ifdef NOT_USED_INVESTIGATE
@@ -523,6 +523,11 @@ void Trace_Arg(REBINT num, const REBVAL *arg, const REBVAL *path)
 		Do_Closure(func);
 		break;
 	case REB_FUNCTION:
+		// Make this the call that stack-relative words of the function
+		// resolve to.  (Free_Call() will restore the shadowed one.)
+		call->shadowed = PARAMLIST_CALL(VAL_FUNC_PARAMLIST(func));
+		PARAMLIST_CALL(VAL_FUNC_PARAMLIST(func)) = call;
+
 		Do_Function(func);
 		break;
 	case REB_ROUTINE:
@@ -1149,11 +1154,24 @@ reevaluate:
 		}
 
 		if (IS_WORD(value)) {
-			// WORD! values may look up to an infix function
+			// WORD! values may look up to an infix function.  This check
+			// happens after nearly every argument evaluation (which are
+			// all DO/NEXTs), and usually fails.  So look at the variable
+			// where it lives instead of copying it into `save` first.
+			// (SELF has no slot to point at, and must be fabricated.)
+
+			const REBVAL *var;
+
+			if (VAL_WORD_INDEX(value) == 0 && HAS_FRAME(value)) {
+				GET_VAR_INTO(&save, value);
+				var = &save;
+			}
+			else
+				var = GET_VAR(value);
 
-			GET_VAR_INTO(&save, value);
-			if (VAL_GET_EXT(&save, EXT_FUNC_INFIX)) {
+			if (VAL_GET_EXT(var, EXT_FUNC_INFIX)) {
 				label = value;
+				if (var != &save) save = *var;
 				value = &save;
 				if (Trace_Flags) Trace_Line(block, index, value);
 				goto do_function_args;
@@ -1162,7 +1180,7 @@ reevaluate:
 			// Perhaps not an infix function, but we just paid for a variable
 			// lookup.  If this isn't just a DO/NEXT, use the work!
 			if (!next) {
-				*out = save;
+				*out = *var;
 				goto do_fetched_word;
 			}
 		}
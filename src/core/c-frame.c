@@ -1246,51 +1246,44 @@
 		// NEGATIVE INDEX: Word is stack-relative bound to a function with
 		// no persistent frame held by the GC.  The value *might* be found
 		// on the stack (or not, if all instances of the function on the
-		// call stack have finished executing).  We walk backward in the call
-		// stack to see if we can find the function's "identifying series"
-		// in a call frame...and take the first instance we see (even if
-		// multiple invocations are on the stack, most recent wins)
+		// call stack have finished executing).  If multiple invocations
+		// are on the stack, the most recent wins...and the function's
+		// "identifying series" (its paramlist) remembers which one that
+		// is, so no walk of the call stack is needed.
 
 		if (index < 0) {
-			struct Reb_Call *call = DSF;
+			struct Reb_Call *call = PARAMLIST_CALL(context);
 
-			// Get_Var could theoretically be called with no evaluation on
-			// the stack, so check for no DSF first...
-			while (call) {
-				if (
-					call->args_ready
-					&& context == VAL_FUNC_PARAMLIST(DSF_FUNC(call))
-				) {
-					REBVAL *value;
+			if (call) {
+				REBVAL *value;
 
-					assert(!IS_CLOSURE(DSF_FUNC(call)));
+				assert(call->args_ready);
+				assert(context == VAL_FUNC_PARAMLIST(DSF_FUNC(call)));
+				assert(!IS_CLOSURE(DSF_FUNC(call)));
 
-					assert(
-						SAME_SYM(
-							VAL_WORD_SYM(word),
-							VAL_TYPESET_SYM(
-								VAL_FUNC_PARAM(DSF_FUNC(call), -index)
-							)
+				assert(
+					SAME_SYM(
+						VAL_WORD_SYM(word),
+						VAL_TYPESET_SYM(
+							VAL_FUNC_PARAM(DSF_FUNC(call), -index)
 						)
-					);
+					)
+				);
 
-					if (
-						writable &&
-						VAL_GET_EXT(
-							VAL_FUNC_PARAM(DSF_FUNC(call), -index),
-							EXT_WORD_LOCK
-						)
-					) {
-						if (trap) raise Error_1(RE_LOCKED_WORD, word);
-						return NULL;
-					}
-
-					value = DSF_ARG(call, -index);
-					assert(!THROWN(value));
-					return value;
+				if (
+					writable &&
+					VAL_GET_EXT(
+						VAL_FUNC_PARAM(DSF_FUNC(call), -index),
+						EXT_WORD_LOCK
+					)
+				) {
+					if (trap) raise Error_1(RE_LOCKED_WORD, word);
+					return NULL;
 				}
 
-				call = PRIOR_DSF(call);
+				value = DSF_ARG(call, -index);
+				assert(!THROWN(value));
+				return value;
 			}
 
 			if (trap) raise Error_1(RE_NO_RELATIVE, word);
@@ -1345,27 +1338,22 @@
 		}
 
 		if (index < 0) {
-			struct Reb_Call *call = DSF;
-			while (call) {
-				if (
-					call->args_ready
-					&& context == VAL_FUNC_PARAMLIST(DSF_FUNC(call))
-				) {
-					assert(
-						SAME_SYM(
-							VAL_WORD_SYM(word),
-							VAL_TYPESET_SYM(
-								VAL_FUNC_PARAM(DSF_FUNC(call), -index)
-							)
+			struct Reb_Call *call = PARAMLIST_CALL(context);
+			if (call) {
+				assert(call->args_ready);
+				assert(
+					SAME_SYM(
+						VAL_WORD_SYM(word),
+						VAL_TYPESET_SYM(
+							VAL_FUNC_PARAM(DSF_FUNC(call), -index)
 						)
-					);
-					assert(!IS_CLOSURE(DSF_FUNC(call)));
-					*out = *DSF_ARG(call, -index);
-					assert(!IS_TRASH(out));
-					assert(!THROWN(out));
-					return;
-				}
-				call = PRIOR_DSF(call);
+					)
+				);
+				assert(!IS_CLOSURE(DSF_FUNC(call)));
+				*out = *DSF_ARG(call, -index);
+				assert(!IS_TRASH(out));
+				assert(!THROWN(out));
+				return;
 			}
 
 			raise Error_1(RE_NO_RELATIVE, word);
@@ -1422,12 +1410,9 @@
 	}
 	if (index == 0) raise Error_0(RE_SELF_PROTECTED);
 
-	// Find relative value:
-	call = DSF;
-	while (VAL_WORD_FRAME(word) != VAL_WORD_FRAME(DSF_LABEL(call))) {
-		call = PRIOR_DSF(call);
-		if (!call) raise Error_1(RE_NOT_DEFINED, word); // change error !!!
-	}
+	// Find relative value (innermost running call of the function):
+	call = PARAMLIST_CALL(VAL_WORD_FRAME(word));
+	if (!call) raise Error_1(RE_NOT_DEFINED, word); // change error !!!
 
 	assert(
 		SAME_SYM(
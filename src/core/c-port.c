@@ -441,9 +441,9 @@
 ***********************************************************************/
 
 #ifdef HAS_POSIX_SIGNAL
-#define MAX_SCHEMES 12		// max native schemes
+#define MAX_SCHEMES 13		// max native schemes
 #else
-#define MAX_SCHEMES 11		// max native schemes
+#define MAX_SCHEMES 12		// max native schemes
 #endif
 
 typedef struct rebol_scheme_actions {
@@ -575,6 +575,7 @@ SCHEME_ACTIONS *Scheme_Actions;	// Initial Global (not threaded)
 	Init_TCP_Scheme();
 	Init_UDP_Scheme();
 	Init_DNS_Scheme();
+	Init_Zlib_Scheme();
 
 #ifdef TO_WINDOWS
 	Init_Clipboard_Scheme();
@@ -134,9 +134,9 @@
 {
 	REBCNT *hashes;
 	REBVAL *word;
-	REBINT hash;
+	REBCNT hash;
 	REBCNT size;
-	REBINT skip;
+	REBCNT skip;
 	REBCNT n;
 
 	// Allocate a new hash table:
@@ -149,13 +149,12 @@
 	size = PG_Word_Table.hashes->tail;
 	for (n = 1; n < PG_Word_Table.series->tail; n++, word++) {
 		const REBYTE *name = VAL_SYM_NAME(word);
-		hash = Hash_Word(name, LEN_BYTES(name));
-		skip  = (hash & 0x0000FFFF) % size;
-		if (skip == 0) skip = 1;
-		hash = (hash & 0x00FFFF00) % size;
+		hash = Mix_Hash(Hash_Word(name, LEN_BYTES(name)));
+		skip = HASH_SKIP(hash, size);
+		hash = HASH_SLOT(hash, size);
 		while (hashes[hash]) {
 			hash += skip;
-			if (hash >= (REBINT)size) hash -= size;
+			if (hash >= size) hash -= size;
 		}
 		hashes[hash] = n;
 	}
@@ -188,9 +187,9 @@
 **
 ***********************************************************************/
 {
-	REBINT	hash;
-	REBINT	size;
-	REBINT	skip;
+	REBCNT	hash;
+	REBCNT	size;
+	REBCNT	skip;
 	REBINT	n;
 	REBCNT	h;
 	REBCNT	*hashes;
@@ -221,15 +220,14 @@
 		CLEAR_SERIES(Bind_Table);
 	}
 
-	size   = (REBINT)PG_Word_Table.hashes->tail;
+	size   = PG_Word_Table.hashes->tail;
 	words  = BLK_HEAD(PG_Word_Table.series);
 	hashes = (REBCNT *)PG_Word_Table.hashes->data;
 
 	// Hash the word, including a skip factor for lookup:
-	hash  = Hash_Word(str, len);
-	skip  = (hash & 0x0000FFFF) % size;
-	if (skip == 0) skip = 1;
-	hash = (hash & 0x00FFFF00) % size;
+	hash = Mix_Hash(Hash_Word(str, len));
+	skip = HASH_SKIP(hash, size);
+	hash = HASH_SLOT(hash, size);
 	//Debug_Fmt("%s hash %d skip %d", str, hash, skip);
 
 	// Search hash table for word match:
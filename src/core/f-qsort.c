@@ -42,7 +42,10 @@ __FBSDID("$FreeBSD$");
 
 #include <stdlib.h>
 
-#define qsort reb_qsort
+// Ren/C: built as qsort_r so comparators get their settings via the thunk
+// instead of a static (SORT must be reentrant for /compare functions).
+#define I_AM_QSORT_R
+#define qsort_r reb_qsort_r
 
 #ifdef I_AM_QSORT_R
 typedef int		 cmp_t(void *, const void *, const void *);
@@ -113,6 +113,7 @@
 
 	case A_REMOVE:
 		// /PART length
+		if (D_REF(4)) raise Error_0(RE_BAD_REFINES); // /KEY is for maps
 		TRAP_PROTECT(VAL_SERIES(value));
 		len = D_REF(2) ? Partial(value, 0, D_ARG(3), 0) : 1;
 		index = (REBINT)VAL_INDEX(value);
@@ -198,7 +199,9 @@ is_true:
 			d2 = VAL_DECIMAL(t);
 			goto chkDecimal;
 		}
-		return THE_SIGN(VAL_INT64(s) - VAL_INT64(t));
+		// Compared, not subtracted, which would overflow:
+		if (VAL_INT64(s) < VAL_INT64(t)) return -1;
+		return VAL_INT64(s) > VAL_INT64(t) ? 1 : 0;
 
 	case REB_LOGIC:
 		return VAL_LOGIC(s) - VAL_LOGIC(t);
@@ -34,6 +34,12 @@
 #include "sys-core.h"
 #include "sys-scan.h"
 
+// SSE2 is part of every x86-64 processor, so this needs no runtime check
+#if defined(__SSE2__) && defined(__GNUC__)
+	#include <emmintrin.h>
+	#define SCAN_SSE2
+#endif
+
 // In UTF8 C0, C1, F5, and FF are invalid.
 #ifdef USE_UNICODE
 #define LEX_UTFE LEX_DEFAULT
@@ -316,6 +322,116 @@
 }
 
 
+#ifdef SCAN_SSE2
+/***********************************************************************
+**
+*/  ATTRIBUTE_NO_SANITIZE_ADDRESS static const REBYTE *Skip_To_Line_End(const REBYTE *cp)
+/*
+**		Return pointer to the first CR, LF, or null byte at or after
+**		cp (so, the end of a comment), testing 16 bytes at a time.
+**
+**		Only aligned blocks are loaded.  They can't cross a page,
+**		so reading past the terminator up to the end of its block
+**		cannot fault (but is invisible to the address sanitizer).
+**
+***********************************************************************/
+{
+	const REBYTE *bp = cast(const REBYTE*, cast(REBUPT, cp) & ~cast(REBUPT, 15));
+	const __m128i cr = _mm_set1_epi8(CR);
+	const __m128i lf = _mm_set1_epi8(LF);
+	const __m128i nul = _mm_setzero_si128();
+	__m128i v = _mm_load_si128(cast(const __m128i*, bp));
+	unsigned int mask;
+
+	mask = _mm_movemask_epi8(_mm_or_si128(
+		_mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)),
+		_mm_cmpeq_epi8(v, nul)
+	));
+	mask >>= cp - bp; // ignore bytes before cp in the first block
+	if (mask) return cp + __builtin_ctz(mask);
+
+	while (TRUE) {
+		bp += 16;
+		v = _mm_load_si128(cast(const __m128i*, bp));
+		mask = _mm_movemask_epi8(_mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)),
+			_mm_cmpeq_epi8(v, nul)
+		));
+		if (mask) return bp + __builtin_ctz(mask);
+	}
+}
+
+
+/***********************************************************************
+**
+*/  ATTRIBUTE_NO_SANITIZE_ADDRESS static REBCNT Plain_Quote_Len(const REBYTE *cp, REBYTE term)
+/*
+**		Count the bytes from cp that Scan_Quote can copy as they are:
+**		stops at term, ^ escapes, braces, CR, LF, null, and UTF-8
+**		lead or continuation bytes.  16 bytes are tested at a time,
+**		loading only aligned blocks (see Skip_To_Line_End).
+**
+***********************************************************************/
+{
+	const REBYTE *bp = cast(const REBYTE*, cast(REBUPT, cp) & ~cast(REBUPT, 15));
+	const __m128i t = _mm_set1_epi8(term);
+	const __m128i caret = _mm_set1_epi8('^');
+	const __m128i lbrace = _mm_set1_epi8('{');
+	const __m128i rbrace = _mm_set1_epi8('}');
+	const __m128i cr = _mm_set1_epi8(CR);
+	const __m128i lf = _mm_set1_epi8(LF);
+	const __m128i nul = _mm_setzero_si128();
+	unsigned int mask;
+	REBOOL first = TRUE;
+	__m128i v;
+
+	for (;; bp += 16) {
+		v = _mm_load_si128(cast(const __m128i*, bp));
+		mask = _mm_movemask_epi8(v) // high bit set: not ASCII
+			| _mm_movemask_epi8(_mm_or_si128(
+				_mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(v, t), _mm_cmpeq_epi8(v, caret)),
+					_mm_or_si128(_mm_cmpeq_epi8(v, lbrace), _mm_cmpeq_epi8(v, rbrace))
+				),
+				_mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)),
+					_mm_cmpeq_epi8(v, nul)
+				)
+			));
+		if (first) {
+			mask >>= cp - bp;
+			if (mask) return __builtin_ctz(mask);
+			first = FALSE;
+		}
+		else if (mask)
+			return (bp - cp) + __builtin_ctz(mask);
+	}
+}
+
+#else
+
+// Byte-at-a-time versions of the above, for other processors
+
+static const REBYTE *Skip_To_Line_End(const REBYTE *cp)
+{
+	while (!ANY_CR_LF_END(*cp)) cp++;
+	return cp;
+}
+
+static REBCNT Plain_Quote_Len(const REBYTE *cp, REBYTE term)
+{
+	const REBYTE *bp = cp;
+	while (
+		*bp >= 0x20 ? (*bp < 0x80 && *bp != term && *bp != '^'
+			&& *bp != '{' && *bp != '}')
+		: (*bp != 0 && *bp != CR && *bp != LF)
+	) bp++;
+	return bp - cp;
+}
+
+#endif
+
+
 /***********************************************************************
 **
 */  static REBINT Scan_Char(const REBYTE **bp)
@@ -427,16 +543,30 @@
 	REBUNI term;
 	REBINT chr;
 	REBCNT lines = 0;
+	REBCNT len;
+	REBUNI *up;
 
 	term = (*src++ == '{') ? '}' : '"';	// pick termination
 
 	while (*src != term || nest > 0) {
 
+		// Copy a run of plain ASCII in one go, without the escape checks:
+		len = Plain_Quote_Len(src, cast(REBYTE, term));
+		if (len > 0) {
+			if (SERIES_LEN(buf) + len + 1 >= SERIES_REST(buf)) // include term.
+				Extend_Series(buf, len + 1);
+			up = UNI_SKIP(buf, buf->tail);
+			buf->tail += len;
+			for (; len > 0; len--) *up++ = *src++;
+			continue;
+		}
+
 		chr = *src;
 
 		switch (chr) {
 
 		case 0:
+			if (scan_state) scan_state->end = src; // ran out of input
 			return 0; // Scan_state shows error location.
 
 		case '^':
@@ -822,7 +952,7 @@
 			DEAD_END;
 
 		case LEX_DELIMIT_SEMICOLON:     /* ; begin comment */
-			while (!ANY_CR_LF_END(*cp)) cp++;
+			cp = Skip_To_Line_End(cp);
 			if (!*cp) cp--;             /* avoid passing EOF  */
 			if (*cp == LF) goto line_feed;
 			/* fall thru  */
@@ -858,17 +988,21 @@
 
 		case LEX_DELIMIT_DOUBLE_QUOTE:
 			RESET_TAIL(BUF_MOLD);
+			scan_state->end = cp;
 			cp = Scan_Quote(BUF_MOLD, cp, scan_state);
 			goto check_str;
 
 		case LEX_DELIMIT_LEFT_BRACE:
 			RESET_TAIL(BUF_MOLD);
+			scan_state->end = cp;
 			cp = Scan_Quote(BUF_MOLD, cp, scan_state);
 		check_str:
 			if (cp) {
 				scan_state->end = cp;
 				return TOKEN_STRING;
 			}
+			// string ran to the end of input, there's nothing to recover
+			if (!*scan_state->end) return -TOKEN_STRING;
 			// try to recover at next new line...
 			cp = scan_state->begin + 1;
 			while (!ANY_CR_LF_END(*cp)) cp++;
@@ -1302,7 +1436,7 @@ scanword:
 		default:	/* everything else... */
 			if (!ANY_CR_LF_END(*cp)) rp = bp = 0;
 		skipline:
-			while (!ANY_CR_LF_END(*cp)) cp++;
+			cp = Skip_To_Line_End(cp);
 			if (*cp == CR && cp[1] == LF) cp++;
 			if (*cp) cp++;
 			count++;
@@ -1807,20 +1941,82 @@ exit_block:
 }
 
 
+/***********************************************************************
+**
+*/	static REBSER *Scan_Partial(SCAN_STATE *scan_state)
+/*
+**		Scan_Block for TRANSCODE/partial.  Returns NULL if the scan
+**		ran into the end of the chunk, as what was cut off there may
+**		continue in the next chunk: a value, an error (or relaxed
+**		error), or a comment (whose rest would otherwise be scanned
+**		as code next time).  The exception is a chunk ending in a
+**		newline, since nothing but a string or block can span one,
+**		and those raise errors when they are left open.
+**
+**		The scan state belongs to the caller, not this function, so
+**		it is still valid after an error longjmps to the trap.
+**
+***********************************************************************/
+{
+	const REBYTE *start = scan_state->end;
+	REBOL_STATE state;
+	const REBVAL *error;
+	REBSER *block;
+
+	PUSH_TRAP(&error, &state);
+
+// The first time through the following code 'error' will be NULL, but...
+// `raise Error` can longjmp here, so 'error' won't be NULL *if* that happens!
+
+	if (error) {
+		if (scan_state->end < scan_state->limit) raise Error_Is(error);
+		return NULL;
+	}
+
+	block = Scan_Block(scan_state, 0);
+
+	DROP_TRAP_SAME_STACKLEVEL_AS_PUSH(&state);
+
+	if (
+		scan_state->end >= scan_state->limit
+		&& (
+			scan_state->limit == start
+			|| scan_state->limit[-1] != LF
+			|| GET_FLAG(scan_state->opts, SCAN_RELAX)
+		)
+	){
+		return NULL;
+	}
+
+	return block;
+}
+
+
 /***********************************************************************
 **
 */	REBNATIVE(transcode)
 /*
 **		Allows BINARY! input only!
 **
+**		With /partial the source is a chunk of a longer stream (like
+**		a log being read from a port in pieces).  Anything that runs
+**		into the end of the chunk may be cut short--a word, an open
+**		block, an unterminated string--so it is left unscanned: the
+**		result is [none source] with the source position unmoved.
+**		The caller appends the next chunk and tries again, calling
+**		without /partial once the stream is exhausted.  Used with
+**		/next this keeps memory to one record, not the whole stream.
+**
 ***********************************************************************/
 {
 	REBVAL * const input = D_ARG(1);
 	const REBOOL next = D_REF(2);
 	const REBOOL only = D_REF(3);
 	const REBOOL relax = D_REF(4);
+	const REBOOL partial = D_REF(5);
 
 	SCAN_STATE scan_state;
+	REBSER *block;
 
 	assert(IS_BINARY(input));
 
@@ -1836,7 +2032,20 @@ exit_block:
 	// If the source data bytes are "1" then it will be the block [1]
 	// if the source data is "[1]" then it will be the block [[1]]
 
-	Val_Init_Block(D_OUT, Scan_Block(&scan_state, 0));
+	if (partial) {
+		block = Scan_Partial(&scan_state);
+		if (!block) {
+			block = Make_Array(2);
+			SET_NONE(Alloc_Tail_Array(block));
+			Append_Value(block, input);
+			Val_Init_Block(D_OUT, block);
+			return R_OUT;
+		}
+	}
+	else
+		block = Scan_Block(&scan_state, 0);
+
+	Val_Init_Block(D_OUT, block);
 
 	// Add a value to the tail of the result, representing the input
 	// with position advanced past the content consumed by the scan.
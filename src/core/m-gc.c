@@ -810,10 +810,11 @@ static void Propagate_All_GC_Marks(void);
 
 /***********************************************************************
 **
-*/	ATTRIBUTE_NO_SANITIZE_ADDRESS static REBCNT Sweep_Series(REBOOL shutdown)
+*/	ATTRIBUTE_NO_SANITIZE_ADDRESS static REBCNT Sweep_Series_Seg(REBSEG *seg, REBOOL shutdown, REBI64 *live)
 /*
-**		Scans all series in all segments that are part of the
-**		SERIES_POOL.  If a series had its lifetime management
+**		Scans all series in one segment of the SERIES_POOL, adding
+**		the size of the survivors to `live`.  If a series had its
+**		lifetime management
 **		delegated to the garbage collector with MANAGE_SERIES(),
 **		then if it didn't get "marked" as live during the marking
 **		phase then free it.
@@ -832,46 +833,156 @@ static void Propagate_All_GC_Marks(void);
 **
 ***********************************************************************/
 {
-	REBSEG *seg;
+	REBSER *series = cast(REBSER *, seg + 1);
 	REBCNT count = 0;
+	REBCNT n;
+
+	for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--, series++) {
+		// See notes on Make_Node() about how the first allocation of a
+		// unit zero-fills *most* of it.  But after that it's up to the
+		// caller of Free_Node() to zero out whatever bits it uses to
+		// indicate "freeness".  We check the zeroness of the `wide`.
+		if (SERIES_FREED(series))
+			continue;
 
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
-		REBSER *series = cast(REBSER *, seg + 1);
-		REBCNT n;
-		for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--, series++) {
-			// See notes on Make_Node() about how the first allocation of a
-			// unit zero-fills *most* of it.  But after that it's up to the
-			// caller of Free_Node() to zero out whatever bits it uses to
-			// indicate "freeness".  We check the zeroness of the `wide`.
-			if (SERIES_FREED(series))
+		if (SERIES_GET_FLAG(series, SER_MANAGED)) {
+			if (shutdown || !SERIES_GET_FLAG(series, SER_MARK)) {
+				GC_Kill_Series(series);
+				count++;
 				continue;
-
-			if (SERIES_GET_FLAG(series, SER_MANAGED)) {
-				if (shutdown || !SERIES_GET_FLAG(series, SER_MARK)) {
-					GC_Kill_Series(series);
-					count++;
-				} else
-					SERIES_CLR_FLAG(series, SER_MARK);
 			}
-			else {
-			#ifdef NDEBUG
+			SERIES_CLR_FLAG(series, SER_MARK);
+		}
+		else {
+		#ifdef NDEBUG
+			SERIES_CLR_FLAG(series, SER_MARK);
+		#else
+			// We should have only been willing to mark a non-managed
+			// series if it had SER_KEEP status
+			if (SERIES_GET_FLAG(series, SER_MARK)) {
+				assert(SERIES_GET_FLAG(series, SER_KEEP));
 				SERIES_CLR_FLAG(series, SER_MARK);
-			#else
-				// We should have only been willing to mark a non-managed
-				// series if it had SER_KEEP status
-				if (SERIES_GET_FLAG(series, SER_MARK)) {
-					assert(SERIES_GET_FLAG(series, SER_KEEP));
-					SERIES_CLR_FLAG(series, SER_MARK);
-				}
-			#endif
 			}
+		#endif
 		}
+
+		*live += SERIES_TOTAL(series);
 	}
 
 	return count;
 }
 
 
+/***********************************************************************
+**
+*/	static REBCNT Sweep_Series(REBOOL shutdown)
+/*
+**		Sweep every segment of the SERIES_POOL.
+**
+***********************************************************************/
+{
+	REBSEG *seg;
+	REBCNT count = 0;
+	REBI64 live = 0;
+
+	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next)
+		count += Sweep_Series_Seg(seg, shutdown, &live);
+
+	PG_Reb_Stats->Recycle_Live_Memory = live;
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	static void Raise_Ballast_Floor(REBI64 live)
+/*
+**		Don't collect again until about as much as survived the last
+**		collection has been allocated.  A large long-lived heap (loaded
+**		data, big maps) is then retraced only once per heap's worth of
+**		new allocation, so GC work stays proportional to allocation and
+**		not to heap size.
+**
+***********************************************************************/
+{
+	REBINT more;
+
+	if (live > MAX_I32) live = MAX_I32;
+	if (VAL_INT64(TASK_BALLAST) >= live) return;
+
+	more = cast(REBINT, live - VAL_INT64(TASK_BALLAST));
+	VAL_INT64(TASK_BALLAST) = live;
+
+	if (REB_I32_ADD_OF(GC_Ballast, more, &GC_Ballast))
+		GC_Ballast = MAX_I32;
+	if (GC_Ballast > 0) CLR_SIGNAL(SIG_RECYCLE);
+}
+
+
+static REBI64 Lazy_Live; // survivors tallied so far by the pending sweep
+
+/***********************************************************************
+**
+*/	REBCNT Sweep_Series_Lazy(void)
+/*
+**		Sweep the next segment left by a lazy collection (see
+**		Recycle_Core).  Make_Node calls this when the series header
+**		free list runs dry, so the sweep is paid for a segment at a
+**		time by allocation instead of inside the GC pause.
+**
+**		Live series in segments already swept no longer carry a mark,
+**		but any series managed since the collection was given one (see
+**		Manage_Series) so the sweep won't take it for garbage.  Those
+**		marks are dropped once the last segment has been visited.
+**
+***********************************************************************/
+{
+	REBSEG *seg = GC_Sweep_Seg;
+	REBINT ballast = GC_Ballast;
+	REBCNT count;
+	REBSER **sp;
+	REBCNT n;
+
+	if (!seg) return 0;
+
+	// Segments added since the collection are prepended to the list,
+	// so following `next` visits only those that existed at the time.
+	GC_Sweep_Seg = seg->next;
+	count = Sweep_Series_Seg(seg, FALSE, &Lazy_Live);
+	PG_Reb_Stats->Recycle_Series_Total += count;
+
+	// The garbage was already paid for when Recycle_Core reset the
+	// ballast, so freeing it here must not credit the ballast again:
+	GC_Ballast = ballast;
+	if (GC_Ballast <= 0) SET_SIGNAL(SIG_RECYCLE);
+
+	if (!GC_Sweep_Seg) {
+		sp = cast(REBSER**, GC_Sweep_Saved->data);
+		for (n = SERIES_TAIL(GC_Sweep_Saved); n > 0; n--, sp++)
+			SERIES_CLR_FLAG(*sp, SER_MARK);
+		SERIES_TAIL(GC_Sweep_Saved) = 0;
+		PG_Reb_Stats->Recycle_Live_Memory = Lazy_Live;
+		Raise_Ballast_Floor(Lazy_Live);
+	}
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	void Finish_Series_Sweep(void)
+/*
+**		Complete any pending lazy sweep.  Must be done before series
+**		marks are used again, whether by a new collection or by code
+**		like PROTECT/deep that borrows SER_MARK to stop on cycles.
+**
+***********************************************************************/
+{
+	while (GC_Sweep_Seg) Sweep_Series_Lazy();
+}
+
+
 /***********************************************************************
 **
 */	ATTRIBUTE_NO_SANITIZE_ADDRESS static REBCNT Sweep_Gobs(void)
@@ -1011,19 +1122,27 @@ static void Propagate_All_GC_Marks(void);
 
 /***********************************************************************
 **
-*/	REBCNT Recycle_Core(REBOOL shutdown)
+*/	REBCNT Recycle_Core(REBOOL shutdown, REBOOL lazy)
 /*
 **		Recycle memory no longer needed.
 **
+**		A lazy recycle only marks, and sweeps the small pools.  The
+**		series pool is left to Sweep_Series_Lazy, so the returned
+**		count does not include the series it will free.
+**
 ***********************************************************************/
 {
 	REBINT n;
 	REBCNT count;
+	REBI64 pause;
 
 	//Debug_Num("GC", GC_Disabled);
 
 	ASSERT_NO_GC_MARKS_PENDING();
 
+	// Marks left by the previous lazy collection must be gone first
+	Finish_Series_Sweep();
+
 	// If disabled, exit now but set the pending flag.
 	if (GC_Disabled || !GC_Active) {
 		SET_SIGNAL(SIG_RECYCLE);
@@ -1035,6 +1154,8 @@ static void Propagate_All_GC_Marks(void);
 
 	GC_Disabled = 1;
 
+	pause = shutdown ? 0 : OS_DELTA_TIME(0, 0);
+
 	PG_Reb_Stats->Recycle_Counter++;
 	PG_Reb_Stats->Recycle_Series = Mem_Pools[SERIES_POOL].free;
 
@@ -1096,7 +1217,12 @@ static void Propagate_All_GC_Marks(void);
 	// with pointers, which can't be simply discarded by Sweep_Series
 	count = Sweep_Routines();
 
-	count += Sweep_Series(shutdown);
+	if (lazy && !shutdown && Mem_Pools[SERIES_POOL].segs) {
+		GC_Sweep_Seg = Mem_Pools[SERIES_POOL].segs;
+		Lazy_Live = 0;
+	}
+	else
+		count += Sweep_Series(shutdown);
 	count += Sweep_Gobs();
 	count += Sweep_Libs();
 
@@ -1117,12 +1243,26 @@ static void Propagate_All_GC_Marks(void);
 		VAL_INT64(TASK_BALLAST) /= 2;
 	}
 
+	// A lazy sweep doesn't know what survived until it finishes, and
+	// raises the floor then (see Sweep_Series_Lazy):
+	if (!GC_Sweep_Seg)
+		Raise_Ballast_Floor(PG_Reb_Stats->Recycle_Live_Memory);
+
 	/* avoid overflow */
 	if (VAL_INT64(TASK_BALLAST) < 0 || VAL_INT64(TASK_BALLAST) >= MAX_I32) {
 		VAL_INT64(TASK_BALLAST) = MAX_I32;
 	}
 
 	GC_Ballast = VAL_INT32(TASK_BALLAST);
+
+	if (!shutdown) {
+		pause = OS_DELTA_TIME(pause, 0);
+		PG_Reb_Stats->Recycle_Last_Time = pause;
+		PG_Reb_Stats->Recycle_Time += pause;
+		if (pause > PG_Reb_Stats->Recycle_Max_Time)
+			PG_Reb_Stats->Recycle_Max_Time = pause;
+	}
+
 	GC_Disabled = 0;
 
 	if (Reb_Opts->watch_recycle) Debug_Fmt(cs_cast(BOOT_STR(RS_WATCH, 1)), count);
@@ -1142,7 +1282,7 @@ static void Propagate_All_GC_Marks(void);
 ***********************************************************************/
 {
 	// Default to not passing the `shutdown` flag.
-	return Recycle_Core(FALSE);
+	return Recycle_Core(FALSE, FALSE);
 }
 
 
@@ -1187,6 +1327,11 @@ static void Propagate_All_GC_Marks(void);
 	GC_Mark_Stack = Make_Series(100, sizeof(REBSER *), MKS_NONE);
 	TERM_SERIES(GC_Mark_Stack);
 	KEEP_SERIES(GC_Mark_Stack, "gc mark stack");
+
+	// Series managed while a lazy sweep is still going through the pool.
+	GC_Sweep_Seg = NULL;
+	GC_Sweep_Saved = Make_Series(15, sizeof(REBSER *), MKS_NONE);
+	KEEP_SERIES(GC_Sweep_Saved, "gc sweep saved");
 }
 
 
@@ -1198,4 +1343,5 @@ static void Propagate_All_GC_Marks(void);
 {
 	Free_Series(GC_Protect);
 	Free_Series(GC_Mark_Stack);
+	Free_Series(GC_Sweep_Saved);
 }
@@ -174,6 +174,30 @@
 }
 
 
+/***********************************************************************
+**
+*/	static void *Alloc_Mem_Unzeroed(size_t size)
+/*
+**		Alloc_Mem for memory the caller writes before reading, such
+**		as the segments of data pools that Make_Node bumps through.
+**		Release builds of Alloc_Mem use calloc(), which would touch
+**		every page of a fresh segment just to zero it.  Free with
+**		Free_Mem (FREE_ARRAY) as usual.
+**
+***********************************************************************/
+{
+#ifdef NDEBUG
+	PG_Mem_Usage += size;
+	if ((PG_Mem_Limit != 0) && (PG_Mem_Usage > PG_Mem_Limit))
+		Check_Security(SYM_MEMORY, POL_EXEC, 0);
+
+	return malloc(size);
+#else
+	return Alloc_Mem(size); // doesn't zero fill in debug builds
+#endif
+}
+
+
 #define POOL_MAP
 
 #define	BAD_MEM_PTR ((REBYTE *)0xBAD1BAD1)
@@ -200,6 +224,14 @@
 	#endif
 #endif
 
+// Series data units are never enumerated, so a data pool can hand out a
+// new segment lazily by bumping a pointer through it, instead of zeroing
+// the segment and threading every unit onto the free list up front.  The
+// node pools (series headers, gobs, ...) are walked by the GC, which needs
+// the zero-filled free state on every unit, so they fill the old way.
+//
+#define BUMP_POOL(p) ((p) < &Mem_Pools[SERIES_POOL])
+
 /***********************************************************************
 **
 **	MEMORY POOLS
@@ -285,6 +317,10 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 		if (Mem_Pools[n].units < 2) Mem_Pools[n].units = 2;
 		Mem_Pools[n].free = 0;
 		Mem_Pools[n].has = 0;
+		Mem_Pools[n].bump = NULL;
+		Mem_Pools[n].bump_end = NULL;
+		Mem_Pools[n].hits = 0;
+		Mem_Pools[n].misses = 0;
 	}
 
 	// For pool lookup. Maps size to pool index. (See Find_Pool below)
@@ -300,6 +336,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	// organized to have some of the logic not in the pools file
 
 	PG_Reb_Stats = ALLOC(REB_STATS);
+	CLEAR(PG_Reb_Stats, sizeof(REB_STATS));
 
 	// Manually allocated series that GC is not responsible for (unless a
 	// trap occurs). Holds series pointers.
@@ -410,7 +447,8 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 **		Allocate memory for a pool.  The amount allocated will be
 **		determined from the size and units specified when the
 **		pool header was created.  The nodes of the pool are linked
-**		to the free list.
+**		to the free list, except in data pools where they are left
+**		for Make_Node to bump through (see BUMP_POOL).
 **
 ***********************************************************************/
 {
@@ -420,10 +458,26 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	REBCNT	units = pool->units;
 	REBCNT	mem_size = pool->wide * units + sizeof(REBSEG);
 
-	seg = cast(REBSEG *, ALLOC_ARRAY(char, mem_size));
+	if (BUMP_POOL(pool))
+		seg = cast(REBSEG *, Alloc_Mem_Unzeroed(mem_size));
+	else
+		seg = cast(REBSEG *, ALLOC_ARRAY(char, mem_size));
 
 	if (!seg) panic Error_No_Memory(mem_size);
 
+	if (BUMP_POOL(pool)) {
+		assert(pool->bump == pool->bump_end); // else units would be lost
+		seg->size = mem_size;
+		seg->next = pool->segs;
+		pool->segs = seg;
+		pool->free += units;
+		pool->has += units;
+		pool->bump = cast(REBYTE *, seg + 1);
+		pool->bump_end = pool->bump + pool->wide * units;
+		ASAN_POISON_MEMORY_REGION(seg, mem_size);
+		return;
+	}
+
 	// !!! See notes above whether a more limited contract between the node
 	// types and the pools could prevent needing to zero all the units.
 	// Also note that (for instance) there is no guarantee that memsetting
@@ -482,8 +536,9 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 **
 */	void *Make_Node(REBCNT pool_id)
 /*
-**		Allocate a node from a pool.  If the pool has run out of
-**		nodes, it will be refilled.
+**		Allocate a node from a pool.  Freed nodes are reused first,
+**		then never-issued units of the newest segment of a data pool.
+**		If the pool has run out of both, it will be refilled.
 **
 **		Note that the node you get back will not be zero-filled
 **		in the general case.  BUT *at least one bit of the node
@@ -496,7 +551,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 **
 **		Here's how:
 **
-**		When a pool segment is allocated, it will initialize all
+**		When a node pool segment is allocated, it will initialize all
 **		the units (which will become REBSERs, REBGOBs, etc.) to
 **		zero bytes, *except* for the first pointer-sized thing in
 **		each unit.  That is used whenever a unit is in the freed
@@ -519,13 +574,34 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 **		need for a full zero-fill, at the cost of dictating the
 **		layout of the node type's struct a little more.
 **
+**		Data pool units (series content) carry no such guarantee:
+**		a fresh one has whatever bits the allocator gave it.
+**
 ***********************************************************************/
 {
 	REBNOD *node;
 	REBPOL *pool;
 
 	pool = &Mem_Pools[pool_id];
-	if (!pool->first) Fill_Pool(pool);
+
+	// Reclaim headers left by a lazy collection before growing the pool
+	if (pool_id == SERIES_POOL)
+		while (!pool->first && GC_Sweep_Seg) Sweep_Series_Lazy();
+
+	if (pool->first)
+		pool->hits++;
+	else {
+		pool->misses++;
+		if (pool->bump == pool->bump_end) Fill_Pool(pool);
+		if (pool->bump != pool->bump_end) {
+			node = cast(REBNOD *, pool->bump);
+			pool->bump += pool->wide;
+			ASAN_UNPOISON_MEMORY_REGION(node, pool->wide);
+			pool->free--;
+			return (void *)node;
+		}
+	}
+
 	node = pool->first;
 
 	ASAN_UNPOISON_MEMORY_REGION(node, pool->wide);
@@ -553,12 +629,18 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 {
 	REBPOL *pool = &Mem_Pools[pool_id];
 
-	if (pool->last == NULL) { //pool is empty
+#ifdef HAVE_ASAN_INTERFACE_H
+	if (pool->last == NULL && !BUMP_POOL(pool)) { //pool is empty
 		Fill_Pool(pool); //insert an empty segment, such that this node won't be picked by next Make_Node to enlongate the poisonous time of this area to catch stale pointers
 	}
-	ASAN_UNPOISON_MEMORY_REGION(pool->last, pool->wide);
-	*(pool->last) = node;
-	ASAN_POISON_MEMORY_REGION(pool->last, pool->wide);
+#endif
+	if (pool->last == NULL)
+		pool->first = node;
+	else {
+		ASAN_UNPOISON_MEMORY_REGION(pool->last, pool->wide);
+		*(pool->last) = node;
+		ASAN_POISON_MEMORY_REGION(pool->last, pool->wide);
+	}
 	pool->last = node;
 	*node = NULL;
 
@@ -777,7 +859,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 		}
 	}
 
-	series->extra.size = 0;
+	series->extra.all = 0; // (.size would not clear a pointer on 64-bit)
 
 	// All series start out in the list of series that must be freed (if not
 	// handed to Manage_Series for the GC to take care of.)  The only way
@@ -834,6 +916,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 		pool = &Mem_Pools[pool_num];
 		*node = pool->first;
 		pool->first = node;
+		if (!pool->last) pool->last = node;
 		pool->free++;
 	}
 	else {
@@ -1264,6 +1347,13 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	assert(!SERIES_GET_FLAG(series, SER_MANAGED));
 	SERIES_SET_FLAG(series, SER_MANAGED);
 
+	// Unmarked, a pending lazy sweep could reach it and kill it
+	if (GC_Sweep_Seg) {
+		SERIES_SET_FLAG(series, SER_MARK);
+		if (SERIES_FULL(GC_Sweep_Saved)) Extend_Series(GC_Sweep_Saved, 8);
+		cast(REBSER**, GC_Sweep_Saved->data)[GC_Sweep_Saved->tail++] = series;
+	}
+
 	// Note: Code repeated in Free_Series()
 	assert(GC_Manuals->tail >= 1);
 	if (*last_ptr != series) {
@@ -1458,6 +1548,10 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 			}
 			if (!seg) goto crash;
 		}
+		// Units not yet bumped out of the newest segment are free too:
+		if (Mem_Pools[pool_num].bump)
+			count += (Mem_Pools[pool_num].bump_end - Mem_Pools[pool_num].bump)
+				/ Mem_Pools[pool_num].wide;
 		// The number of free nodes must agree with header:
 		if (
 			(Mem_Pools[pool_num].free != count) ||
@@ -1569,7 +1663,7 @@ crash:
 			size += seg->size;
 
 		used = Mem_Pools[n].has - Mem_Pools[n].free;
-		Debug_Fmt("Pool[%-2d] %-4dB %-5d/%-5d:%-4d (%-2d%%) %-2d segs, %-07d total",
+		Debug_Fmt("Pool[%-2d] %-4dB %-5d/%-5d:%-4d (%-2d%%) %-2d segs, %-07d total, %d hits %d misses",
 			n,
 			Mem_Pools[n].wide,
 			used,
@@ -1577,7 +1671,9 @@ crash:
 			Mem_Pools[n].units,
 			Mem_Pools[n].has ? ((used * 100) / Mem_Pools[n].has) : 0,
 			segs,
-			size
+			size,
+			Mem_Pools[n].hits,
+			Mem_Pools[n].misses
 		);
 
 		tused += used * Mem_Pools[n].wide;
@@ -1589,6 +1685,50 @@ crash:
 }
 
 
+/***********************************************************************
+**
+*/	REBSER *Pool_Stats(void)
+/*
+**		Return a block holding, for each memory pool, a block of:
+**		unit width, units used, units total, segments, hits, misses.
+**
+***********************************************************************/
+{
+	REBSER *block = Make_Array(SYSTEM_POOL);
+	REBSER *stats;
+	REBVAL *val;
+	REBSEG *seg;
+	REBCNT segs;
+	REBCNT n;
+
+	for (n = 0; n < SYSTEM_POOL; n++) {
+		REBPOL *pool = &Mem_Pools[n];
+
+		segs = 0;
+		for (seg = pool->segs; seg; seg = seg->next) segs++;
+
+		stats = Make_Array(6);
+		val = Alloc_Tail_Array(stats);
+		SET_INTEGER(val, pool->wide);
+		val = Alloc_Tail_Array(stats);
+		SET_INTEGER(val, pool->has - pool->free);
+		val = Alloc_Tail_Array(stats);
+		SET_INTEGER(val, pool->has);
+		val = Alloc_Tail_Array(stats);
+		SET_INTEGER(val, segs);
+		val = Alloc_Tail_Array(stats);
+		SET_INTEGER(val, pool->hits);
+		val = Alloc_Tail_Array(stats);
+		SET_INTEGER(val, pool->misses);
+
+		val = Alloc_Tail_Array(block);
+		Val_Init_Block(val, stats);
+	}
+
+	return block;
+}
+
+
 /***********************************************************************
 **
 */	REBU64 Inspect_Series(REBCNT flags)
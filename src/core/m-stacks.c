@@ -285,6 +285,16 @@
 {
 	assert(call == CS_Top);
 
+	// If this was the innermost running call of a FUNCTION!, then the
+	// call it shadowed becomes the target of relative word lookups again.
+	// (Pending calls that were never dispatched are not registered.)
+	if (
+		IS_FUNCTION(DSF_FUNC(call))
+		&& PARAMLIST_CALL(VAL_FUNC_PARAMLIST(DSF_FUNC(call))) == call
+	) {
+		PARAMLIST_CALL(VAL_FUNC_PARAMLIST(DSF_FUNC(call))) = call->shadowed;
+	}
+
 	// Drop to the prior top call stack frame
 	CS_Top = call->prior;
 
@@ -185,6 +185,9 @@ enum {
 
 	Check_Security(SYM_PROTECT, POL_WRITE, val);
 
+	// SER_MARK is used below to stop on cycles; no GC marks may linger
+	Finish_Series_Sweep();
+
 	if (D_REF(2)) SET_FLAG(flags, PROT_DEEP);
 	//if (D_REF(3)) SET_FLAG(flags, PROT_WORD);
 
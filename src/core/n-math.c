@@ -589,6 +589,41 @@ compare:
 }
 
 
+/***********************************************************************
+**
+*/	REBNATIVE(sum_of)
+/*
+***********************************************************************/
+{
+	Total_Vector(D_OUT, D_ARG(1), NULL);
+	return R_OUT;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(dot_product)
+/*
+***********************************************************************/
+{
+	Total_Vector(D_OUT, D_ARG(1), D_ARG(2));
+	return R_OUT;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(extreme_of)
+/*
+***********************************************************************/
+{
+	REBVAL *vect = D_ARG(1);
+
+	VAL_INDEX(vect) += Find_Vector_Extreme(vect, D_REF(2));
+	return R_ARG1;
+}
+
+
 /***********************************************************************
 **
 */	REBNATIVE(negativeq)
@@ -42,6 +42,49 @@ enum {
 #define SET_OP_EXCLUDE		(FLAGIT(SOP_CHECK) | FLAGIT(SOP_INVERT))
 #define SET_OP_DIFFERENCE	(FLAGIT(SOP_BOTH) | FLAGIT(SOP_CHECK) | FLAGIT(SOP_INVERT))
 
+#define MIN_SET_HASH 16 // block size to switch to hashing
+
+
+/***********************************************************************
+**
+*/	static REBOOL Find_Set_Value(REBSER *series, REBCNT index, REBVAL *key, REBCNT cased)
+/*
+**		Linear search of a small block, instead of hashing it.
+**		Values match as they do for Find_Key, and a key that can't
+**		be hashed is an error here too.  So only values with the
+**		same hash are compared: Cmp_Value finds some values equal
+**		that hash apart (decimals within tolerance, dates in other
+**		zones...), and the result mustn't depend on block size.
+**
+***********************************************************************/
+{
+	REBVAL *val;
+	REBCNT hash = Hash_Value(key);
+
+	if (!hash) raise Error_Has_Bad_Type(key);
+
+	for (; index < SERIES_TAIL(series); index++) {
+		val = BLK_SKIP(series, index);
+		if (Hash_Value(val) != hash) continue;
+		if (ANY_WORD(key)) {
+			if (
+				ANY_WORD(val) &&
+				(VAL_WORD_SYM(key) == VAL_WORD_SYM(val) ||
+				(!cased && VAL_WORD_CANON(key) == VAL_WORD_CANON(val)))
+			) return TRUE;
+		}
+		else if (VAL_TYPE(val) == VAL_TYPE(key)) {
+			if (ANY_BINSTR(key)) {
+				if (0 == Compare_String_Vals(key, val, (REBOOL)(!IS_BINARY(key) && !cased)))
+					return TRUE;
+			}
+			else if (0 == Cmp_Value(key, val, !cased)) return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
 
 /***********************************************************************
 **
@@ -62,6 +105,9 @@ enum {
 	REBINT h = TRUE;
 	REBCNT skip = 1;	// record size
 	REBCNT cased = 0;	// case sensitive when TRUE
+	REBCNT bits;		// chars covered by string bitmaps
+	REBYTE *found;		// bitmap of chars in the other string
+	REBYTE *added;		// bitmap of chars added to the result
 
 	SET_NONE(D_OUT);
 	val1 = D_ARG(1);
@@ -86,26 +132,40 @@ enum {
 		if (GET_FLAG(flags, SOP_BOTH)) i += VAL_LEN(val2);
 		retser = BUF_EMIT;			// use preallocated shared block
 		Resize_Series(retser, i);
-		hret = Make_Hash_Sequence(i);	// allocated
 
-		// Optimization note: !!
-		// This code could be optimized for small blocks by not hashing them
-		// and extending Find_Key to do a FIND on the value itself w/o the hash.
+		// Small blocks are searched linearly, as small maps are (see
+		// MIN_DICT), which saves making and clearing hash tables. Record
+		// sizes other than 1 always hash.
+		hret = (skip == 1 && i < MIN_SET_HASH) ? 0 : Make_Hash_Sequence(i);
 
 		do {
 			// Check what is in series1 but not in series2:
-			if (GET_FLAG(flags, SOP_CHECK))
-				hser = Hash_Block(val2, cased);
+			if (GET_FLAG(flags, SOP_CHECK)) {
+				if (skip == 1 && VAL_LEN(val2) < MIN_SET_HASH) {
+					for (val = VAL_BLK_DATA(val2); NOT_END(val); val++) {
+						if (!Hash_Value(val)) raise Error_Has_Bad_Type(val);
+					}
+				}
+				else
+					hser = Hash_Block(val2, cased);
+			}
 
 			// Iterate over first series:
 			ser = VAL_SERIES(val1);
 			i = VAL_INDEX(val1);
 			for (; val = BLK_SKIP(ser, i), i < SERIES_TAIL(ser); i += skip) {
 				if (GET_FLAG(flags, SOP_CHECK)) {
-					h = Find_Key(VAL_SERIES(val2), hser, val, skip, cased, 1) >= 0;
+					if (hser)
+						h = Find_Key(VAL_SERIES(val2), hser, val, skip, cased, 1) >= 0;
+					else
+						h = Find_Set_Value(VAL_SERIES(val2), VAL_INDEX(val2), val, cased);
 					if (GET_FLAG(flags, SOP_INVERT)) h = !h;
 				}
-				if (h) Find_Key(retser, hret, val, skip, cased, 2);
+				if (!h) continue;
+				if (hret)
+					Find_Key(retser, hret, val, skip, cased, 2);
+				else if (!Find_Set_Value(retser, 0, val, cased))
+					Append_Value(retser, val);
 			}
 
 			// Iterate over second series?
@@ -116,8 +176,10 @@ enum {
 				CLR_FLAG(flags, SOP_BOTH);
 			}
 
-			if (GET_FLAG(flags, SOP_CHECK))
+			if (hser) {
 				Free_Series(hser);
+				hser = 0;
+			}
 		} while (i);
 
 		if (hret)
@@ -140,21 +202,40 @@ enum {
 		Reset_Buffer(retser, i);
 		RESET_TAIL(retser);
 
+		// Bitmaps indexed by char (lowercased unless cased): one marks
+		// chars of the other series, one marks chars already added to
+		// the result. Records compare by their first char, as FIND/SKIP.
+		bits = (VAL_BYTE_SIZE(val1) && (!val2 || VAL_BYTE_SIZE(val2))) ? 0x100 : 0x10000;
+		hser = Make_Binary(bits / 4);
+		found = BIN_HEAD(hser);
+		added = found + bits / 8;
+		CLEAR(added, bits / 8);
+
 		do {
 			REBUNI uc;
 
-			cased = cased ? AM_FIND_CASE : 0;
+			if (GET_FLAG(flags, SOP_CHECK)) {
+				CLEAR(found, bits / 8);
+				ser = VAL_SERIES(val2);
+				for (i = VAL_INDEX(val2); i < VAL_TAIL(val2); i += skip) {
+					uc = GET_ANY_CHAR(ser, i);
+					if (!cased && uc < UNICODE_CASES) uc = LO_CASE(uc);
+					found[uc >> 3] |= 1 << (uc & 7);
+				}
+			}
 
 			// Iterate over first series:
 			ser = VAL_SERIES(val1);
 			i = VAL_INDEX(val1);
 			for (; i < SERIES_TAIL(ser); i += skip) {
 				uc = GET_ANY_CHAR(ser, i);
+				if (!cased && uc < UNICODE_CASES) uc = LO_CASE(uc);
 				if (GET_FLAG(flags, SOP_CHECK)) {
-					h = Find_Str_Char(VAL_SERIES(val2), 0, VAL_INDEX(val2), VAL_TAIL(val2), skip, uc, cased) != NOT_FOUND;
+					h = (found[uc >> 3] & (1 << (uc & 7))) != 0;
 					if (GET_FLAG(flags, SOP_INVERT)) h = !h;
 				}
-				if (h && (Find_Str_Char(retser, 0, 0, SERIES_TAIL(retser), skip, uc, cased) == NOT_FOUND)) {
+				if (h && !(added[uc >> 3] & (1 << (uc & 7)))) {
+					added[uc >> 3] |= 1 << (uc & 7);
 					Append_String(retser, ser, i, skip);
 				}
 			}
@@ -168,6 +249,8 @@ enum {
 			}
 		} while (i);
 
+		Free_Series(hser);
+
 		ser = Copy_String(retser, 0, -1);
 		if (IS_BINARY(D_OUT))
 			Val_Init_Binary(D_OUT, ser);
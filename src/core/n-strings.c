@@ -296,12 +296,18 @@ static struct digest {
 	REBSER *ser;
 	REBCNT index;
 	REBCNT len;
+	REBINT level = -1; // zlib's default
 
 	len = Partial1(D_ARG(1), D_ARG(3));
 
+	if (D_REF(5)) { // /level
+		level = Int32(D_ARG(6));
+		if (level < 0 || level > 9) raise Error_Out_Of_Range(D_ARG(6));
+	}
+
 	ser = Temp_Bin_Str_Managed(D_ARG(1), &index, &len);
 
-	Val_Init_Binary(D_OUT, Compress(ser, index, len, D_REF(4))); // /gzip
+	Val_Init_Binary(D_OUT, Compress(ser, index, len, D_REF(4), level)); // /gzip
 
 	return R_OUT;
 }
@@ -167,6 +167,16 @@
 
 			stats++;
 			SET_INTEGER(stats, PG_Reb_Stats->Recycle_Counter);
+
+			stats++;
+			VAL_TIME(stats) = PG_Reb_Stats->Recycle_Time * 1000;
+			VAL_SET(stats, REB_TIME);
+			stats++;
+			VAL_TIME(stats) = PG_Reb_Stats->Recycle_Max_Time * 1000;
+			VAL_SET(stats, REB_TIME);
+			stats++;
+			VAL_TIME(stats) = PG_Reb_Stats->Recycle_Last_Time * 1000;
+			VAL_SET(stats, REB_TIME);
 		}
 		return R_OUT;
 	}
@@ -177,6 +187,11 @@
 		return R_NONE;
 	}
 
+	if (D_REF(7)) {
+		Val_Init_Block(D_OUT, Pool_Stats());
+		return R_OUT;
+	}
+
 	if (D_REF(1)) flags = 3;
 	n = Inspect_Series(flags);
 
@@ -222,7 +222,13 @@ enum Transport_Types {
 		}
 		ser = VAL_SERIES(arg);
 		sock->length = SERIES_AVAIL(ser); // space available
-		if (sock->length < NET_BUF_SIZE/2) Extend_Series(ser, NET_BUF_SIZE);
+		if (sock->length < NET_BUF_SIZE/2) {
+			// Grow in proportion to what is already buffered, so reading
+			// a long stream costs a logarithmic number of reallocations
+			// instead of one per NET_BUF_SIZE.  (A buffer the awake code
+			// has cleared is reused as-is, with no reallocation at all.)
+			Extend_Series(ser, MAX(cast(REBCNT, NET_BUF_SIZE), SERIES_TAIL(ser)));
+		}
 		sock->length = SERIES_AVAIL(ser);
 		sock->common.data = STR_TAIL(ser); // write at tail
 		//if (SERIES_TAIL(ser) == 0)
@@ -0,0 +1,240 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  p-zlib.c
+**  Summary: zlib compression stream port interface
+**  Section: ports
+**  Notes:
+**
+**		Data is passed through a zlib stream in pieces, so it never
+**		has to be in memory all at once:
+**
+**			z: open [scheme: 'zlib mode: 'deflate format: 'gzip]
+**			write z data ; as many times as needed
+**			update z ; no more data
+**			read z ; what has come out so far
+**
+**		With a SOURCE port in the spec, READ takes its input from
+**		that port (read/part in chunks) instead of from WRITE:
+**
+**			z: open [scheme: 'zlib format: 'gzip source: open %log.gz]
+**			while [data: read/part z 100000] [...]
+**
+**		READ gives NONE once the stream has ended and all of its
+**		output has been read. The port must be closed to release
+**		zlib's memory; the source port is left open.
+**
+**		!!! zlib's memory is not known to the GC, so a port that is
+**		garbage collected without being closed leaks it (ports have
+**		no hook to be finalized with).
+**
+***********************************************************************/
+
+#include "sys-core.h"
+
+// How much is read from a source port at a time:
+#define ZLIB_SOURCE_CHUNK 0x10000
+
+
+/***********************************************************************
+**
+*/	static REBSER *Open_Zlib_Stream(REBSER *port)
+/*
+**		Make the zlib stream for the port spec's MODE, FORMAT and
+**		LEVEL.
+**
+***********************************************************************/
+{
+	REBVAL *spec = OFV(port, STD_PORT_SPEC);
+	REBVAL *mode = Obj_Value(spec, STD_PORT_SPEC_ZLIB_MODE);
+	REBVAL *format = Obj_Value(spec, STD_PORT_SPEC_ZLIB_FORMAT);
+	REBVAL *level = Obj_Value(spec, STD_PORT_SPEC_ZLIB_LEVEL);
+	REBFLG deflating;
+	REBCNT sym;
+	REBINT n = -1; // zlib's default level
+
+	if (!IS_WORD(mode)) raise Error_1(RE_INVALID_SPEC, mode);
+	sym = VAL_WORD_CANON(mode);
+	if (sym != SYM_INFLATE && sym != SYM_DEFLATE)
+		raise Error_1(RE_INVALID_SPEC, mode);
+	deflating = (sym == SYM_DEFLATE);
+
+	if (!IS_WORD(format)) raise Error_1(RE_INVALID_SPEC, format);
+	sym = VAL_WORD_CANON(format);
+	if (sym != SYM_ZLIB && sym != SYM_GZIP && sym != SYM_DEFLATE)
+		raise Error_1(RE_INVALID_SPEC, format);
+
+	if (IS_INTEGER(level)) {
+		n = Int32(level);
+		if (n < 0 || n > 9) raise Error_Out_Of_Range(level);
+	}
+	else if (!IS_NONE(level)) raise Error_1(RE_INVALID_SPEC, level);
+
+	return Make_Zstream(deflating, sym, n);
+}
+
+
+/***********************************************************************
+**
+*/	static void Read_Zlib_Source(struct Reb_Call *call_, REBSER *port, REBSER *zs, REBSER *out, REBCNT len)
+/*
+**		Pass data from the spec's SOURCE port through the stream until
+**		there are len bytes of output, or the stream has ended. The
+**		end of the source ends the stream.
+**
+***********************************************************************/
+{
+	REBVAL *spec = OFV(port, STD_PORT_SPEC);
+	REBVAL *source = Obj_Value(spec, STD_PORT_SPEC_ZLIB_SOURCE);
+	REBVAL size;
+	REBINT result;
+
+	if (IS_NONE(source)) return;
+	if (!IS_PORT(source)) raise Error_1(RE_INVALID_SPEC, source);
+
+	SET_INTEGER(&size, ZLIB_SOURCE_CHUNK);
+
+	while (SERIES_TAIL(out) < len && !Zstream_Ended(zs)) {
+		// D_OUT holds the chunk, to keep it safe from the GC:
+		if (Do_Sys_Func_Throws(D_OUT, SYS_CTX_READ_PART_P, source, &size, 0))
+			raise Error_No_Catch_For_Throw(D_OUT);
+
+		if (IS_BINARY(D_OUT) && VAL_LEN(D_OUT) > 0)
+			result = Zstream_Feed(
+				zs, VAL_BIN_DATA(D_OUT), VAL_LEN(D_OUT), FALSE, out, 0
+			);
+		else
+			result = Zstream_Feed(zs, NULL, 0, TRUE, out, 0);
+
+		if (result < 0) raise Error_Zlib(result);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static REB_R Zlib_Actor(struct Reb_Call *call_, REBSER *port, REBCNT action)
+/*
+**		The port state holds the zlib stream, and the port data holds
+**		the output that has not been read yet.
+**
+***********************************************************************/
+{
+	REBVAL *state;
+	REBVAL *data;
+	REBVAL *arg;
+	REBSER *zs;
+	REBSER *out;
+	REBSER *ser;
+	REBCNT index;
+	REBCNT len;
+	REBINT result;
+
+	Validate_Port(port, action);
+
+	arg = DS_ARGC > 1 ? D_ARG(2) : NULL;
+	state = BLK_SKIP(port, STD_PORT_STATE);
+	data = BLK_SKIP(port, STD_PORT_DATA);
+
+	if (!IS_BINARY(state)) {
+		switch (action) {
+		case A_OPEN:
+			Val_Init_Binary(state, Open_Zlib_Stream(port));
+			Val_Init_Binary(data, Make_Binary(ZLIB_SOURCE_CHUNK));
+			return R_ARG1;
+
+		case A_CLOSE:
+			return R_ARG1;
+
+		case A_OPENQ:
+			return R_FALSE;
+
+		default:
+			raise Error_On_Port(RE_NOT_OPEN, port, -12);
+		}
+	}
+
+	zs = VAL_SERIES(state);
+	out = VAL_SERIES(data);
+
+	switch (action) {
+	case A_WRITE:
+		if (!IS_STRING(arg) && !IS_BINARY(arg))
+			raise Error_1(RE_INVALID_PORT_ARG, arg);
+
+		// Strings are passed through as UTF-8:
+		len = Partial1(arg, D_ARG(ARG_WRITE_LIMIT));
+		ser = Temp_Bin_Str_Managed(arg, &index, &len);
+
+		result = Zstream_Feed(zs, BIN_SKIP(ser, index), len, FALSE, out, 0);
+		if (result < 0) raise Error_Zlib(result);
+		break;
+
+	case A_UPDATE:
+		// No more data will be written (this ends a deflate stream):
+		result = Zstream_Feed(zs, NULL, 0, TRUE, out, 0);
+		if (result < 0) raise Error_Zlib(result);
+		break;
+
+	case A_READ:
+		// /part gives at most that much, else all there is (but at
+		// least something, if the source has more):
+		if (D_REF(ARG_READ_PART)) {
+			len = Int32s(D_ARG(ARG_READ_LIMIT), 1);
+			Read_Zlib_Source(call_, port, zs, out, len);
+			len = MIN(len, SERIES_TAIL(out));
+		}
+		else {
+			Read_Zlib_Source(call_, port, zs, out, 1);
+			len = SERIES_TAIL(out);
+		}
+
+		if (len == 0 && Zstream_Ended(zs)) return R_NONE;
+
+		Val_Init_Binary(D_OUT, Copy_Bytes(BIN_HEAD(out), len));
+		Remove_Series(out, 0, len);
+		return R_OUT;
+
+	case A_CLOSE:
+		Free_Zstream(zs);
+		SET_NONE(state);
+		SET_NONE(data);
+		break;
+
+	case A_OPENQ:
+		return R_TRUE;
+
+	default:
+		raise Error_Illegal_Action(REB_PORT, action);
+	}
+
+	return R_ARG1; // port
+}
+
+
+/***********************************************************************
+**
+*/	void Init_Zlib_Scheme(void)
+/*
+***********************************************************************/
+{
+	Register_Scheme(SYM_ZLIB, 0, Zlib_Actor);
+}
@@ -179,15 +179,38 @@ static REBCNT *CRC_Table;
 
 /***********************************************************************
 **
-*/	REBINT Hash_Value(REBVAL *val, REBCNT hash_size)
+*/	REBCNT Mix_Hash(REBU64 bits)
+/*
+**		Scramble the bits so that every input bit affects every bit
+**		of the result (the 64-bit finalizer of MurmurHash3).  Keys
+**		which differ only a little, like sequential integers, dates
+**		or symbol numbers, then spread evenly across a hash table.
+**
+***********************************************************************/
+{
+	bits ^= bits >> 33;
+	bits *= U64_C(0xff51afd7ed558ccd);
+	bits ^= bits >> 33;
+	bits *= U64_C(0xc4ceb9fe1a85ec53);
+	bits ^= bits >> 33;
+
+	return (REBCNT)bits;
+}
+
+
+/***********************************************************************
+**
+*/	REBCNT Hash_Value(REBVAL *val)
 /*
 **		Return a case insensitive hash value for any value.
 **
-**		Result will be > 0 and < hash_size, except if
-**		datatype cannot be hashed, a 0 is returned.
+**		Result is a well mixed 32-bit number, reduced by the caller
+**		to a table slot (see HASH_SLOT).  It is never 0, except if
+**		the datatype cannot be hashed.
 **
 ***********************************************************************/
 {
+	REBU64 bits;
 	REBCNT ret;
 	const REBYTE *name;
 
@@ -199,7 +222,7 @@ static REBCNT *CRC_Table;
 	case REB_LIT_WORD:
 	case REB_REFINEMENT:
 	case REB_ISSUE:
-		ret = VAL_WORD_CANON(val);
+		bits = VAL_WORD_CANON(val);
 		break;
 
 	case REB_BINARY:
@@ -208,62 +231,65 @@ static REBCNT *CRC_Table;
 	case REB_EMAIL:
 	case REB_URL:
 	case REB_TAG:
-		ret = Hash_String(VAL_BIN_DATA(val), Val_Byte_Len(val));
+		bits = Hash_String(VAL_BIN_DATA(val), Val_Byte_Len(val));
 		break;
 
 	case REB_LOGIC:
-		ret = VAL_LOGIC(val) ? (hash_size/5) : (2*hash_size/5);
+		bits = VAL_LOGIC(val) ? 1 : 2;
 		break;
 
 	case REB_INTEGER:
 	case REB_DECIMAL: // depends on INT64 sharing the DEC64 bits
-		ret = (REBCNT)(VAL_INT64(val) >> 32) ^ ((REBCNT)VAL_INT64(val));
+		bits = (REBU64)VAL_INT64(val);
 		break;
 
 	case REB_CHAR:
-		ret = VAL_CHAR(val) << 15; // avoid running into WORD hashes
+		bits = VAL_CHAR(val);
 		break;
 
 	case REB_MONEY:
-		ret = VAL_ALL_BITS(val)[0] ^ VAL_ALL_BITS(val)[1] ^ VAL_ALL_BITS(val)[2];
+		bits = ((REBU64)VAL_ALL_BITS(val)[0] << 32)
+			^ ((REBU64)VAL_ALL_BITS(val)[1] << 16)
+			^ VAL_ALL_BITS(val)[2];
 		break;
 
 	case REB_TIME:
 	case REB_DATE:
-		ret = (REBCNT)(VAL_TIME(val) ^ (VAL_TIME(val) / SEC_SEC));
-		if (IS_DATE(val)) ret ^= VAL_DATE(val).bits;
+		bits = (REBU64)VAL_TIME(val);
+		if (IS_DATE(val)) bits ^= (REBU64)VAL_DATE(val).bits << 40;
 		break;
 
 	case REB_TUPLE:
-		ret = Hash_String(VAL_TUPLE(val), VAL_TUPLE_LEN(val));
+		bits = Hash_String(VAL_TUPLE(val), VAL_TUPLE_LEN(val));
 		break;
 
 	case REB_PAIR:
-		ret = VAL_ALL_BITS(val)[0] ^ VAL_ALL_BITS(val)[1];
+		bits = ((REBU64)VAL_ALL_BITS(val)[0] << 32) ^ VAL_ALL_BITS(val)[1];
 		break;
 
 	case REB_OBJECT:
-		ret = (REBCNT)((REBUPT)VAL_OBJ_FRAME(val) >> 4);
+		bits = (REBU64)(REBUPT)VAL_OBJ_FRAME(val);
 		break;
 
 	case REB_DATATYPE:
 		name = Get_Sym_Name(VAL_TYPE_SYM(val));
-		ret = Hash_Word(name, LEN_BYTES(name));
+		bits = Hash_Word(name, LEN_BYTES(name));
 		break;
 
 	case REB_NONE:
-		ret = 1;
+		bits = 1;
 		break;
 
 	case REB_UNSET:
-		ret = 0;
+		bits = 0;
 		break;
 
 	default:
-		return 0;  //ret = 3 * (hash_size/5);
+		return 0;
 	}
 
-	return 1 + ((hash_size-1) & ret);
+	ret = Mix_Hash(bits);
+	return ret ? ret : 1;
 }
 
 
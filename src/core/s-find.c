@@ -290,6 +290,158 @@
 }
 
 
+#define MIN_SKIP_PATTERN 8	// shortest pattern worth a skip table
+#define MIN_SKIP_TEXT 256	// shortest text worth a skip table
+
+#define FOLD_UNI(c) (((c) < UNICODE_CASES) ? LO_CASE(c) : (c))
+
+
+/***********************************************************************
+**
+*/	static REBCNT Find_Bytes(const REBYTE *bp, REBCNT len, const REBYTE *pat, REBCNT plen, REBFLG uncase)
+/*
+**		Forward search for a byte pattern within len bytes. The match
+**		must fit entirely within len. Returns offset or NOT_FOUND.
+**
+**		Short patterns filter on the first byte (memchr, which the C
+**		library vectorizes) then compare the rest. Long patterns in
+**		long text use Boyer-Moore-Horspool, so a mismatch skips ahead
+**		by up to the pattern length.
+**
+***********************************************************************/
+{
+	const REBYTE *cp;
+	const REBYTE *ep;
+	REBCNT last;
+	REBCNT n;
+	REBYTE c;
+
+	if (plen == 0 || plen > len) return NOT_FOUND;
+
+	last = plen - 1;
+
+	if (plen >= MIN_SKIP_PATTERN && len >= MIN_SKIP_TEXT) {
+		REBCNT shift[256];
+		REBCNT i;
+
+		// Shift by distance of the byte's last occurrence from the end:
+		for (n = 0; n < 256; n++) shift[n] = plen;
+		for (n = 0; n < last; n++)
+			shift[uncase ? LO_CASE(pat[n]) : pat[n]] = last - n;
+
+		if (!uncase) {
+			c = pat[last];
+			for (i = 0; i <= len - plen; i += shift[bp[i + last]]) {
+				if (bp[i + last] == c && memcmp(bp + i, pat, last) == 0)
+					return i;
+			}
+		}
+		else {
+			c = (REBYTE)LO_CASE(pat[last]); // OK! (never > 255)
+			for (i = 0; i <= len - plen; i += shift[LO_CASE(bp[i + last])]) {
+				if (LO_CASE(bp[i + last]) != c) continue;
+				for (n = 0; n < last; n++) {
+					if (LO_CASE(bp[i + n]) != LO_CASE(pat[n])) break;
+				}
+				if (n == last) return i;
+			}
+		}
+		return NOT_FOUND;
+	}
+
+	ep = bp + (len - last); // past the last possible start
+
+	if (!uncase) {
+		for (cp = bp; cp < ep; cp++) {
+			cp = cast(const REBYTE*, memchr(cp, pat[0], ep - cp));
+			if (!cp) break;
+			if (memcmp(cp + 1, pat + 1, last) == 0) return cp - bp;
+		}
+	}
+	else {
+		c = (REBYTE)LO_CASE(pat[0]);
+		for (cp = bp; cp < ep; cp++) {
+			if (LO_CASE(*cp) != c) continue;
+			for (n = 1; n < plen; n++) {
+				if (LO_CASE(cp[n]) != LO_CASE(pat[n])) break;
+			}
+			if (n == plen) return cp - bp;
+		}
+	}
+
+	return NOT_FOUND;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Find_Unis(const REBUNI *up, REBCNT len, const REBUNI *pat, REBCNT plen, REBFLG uncase)
+/*
+**		Forward search for a wide pattern within len wide chars.
+**		Same contract as Find_Bytes. The skip table is indexed by
+**		the low byte of each char; a bucket keeps its smallest shift,
+**		so chars sharing a bucket never skip past a match.
+**
+***********************************************************************/
+{
+	REBCNT last;
+	REBCNT i;
+	REBCNT n;
+	REBUNI c;
+
+	if (plen == 0 || plen > len) return NOT_FOUND;
+
+	last = plen - 1;
+
+	if (plen >= MIN_SKIP_PATTERN && len >= MIN_SKIP_TEXT) {
+		REBCNT shift[256];
+
+		for (n = 0; n < 256; n++) shift[n] = plen;
+		for (n = 0; n < last; n++)
+			shift[(uncase ? FOLD_UNI(pat[n]) : pat[n]) & 0xff] = last - n;
+
+		if (!uncase) {
+			c = pat[last];
+			for (i = 0; i <= len - plen; i += shift[up[i + last] & 0xff]) {
+				if (up[i + last] == c && memcmp(up + i, pat, last * sizeof(REBUNI)) == 0)
+					return i;
+			}
+		}
+		else {
+			c = FOLD_UNI(pat[last]);
+			for (i = 0; i <= len - plen; i += shift[FOLD_UNI(up[i + last]) & 0xff]) {
+				if (FOLD_UNI(up[i + last]) != c) continue;
+				for (n = 0; n < last; n++) {
+					if (FOLD_UNI(up[i + n]) != FOLD_UNI(pat[n])) break;
+				}
+				if (n == last) return i;
+			}
+		}
+		return NOT_FOUND;
+	}
+
+	if (!uncase) {
+		c = pat[0];
+		for (i = 0; i < len - last; i++) {
+			if (up[i] == c && memcmp(up + i + 1, pat + 1, last * sizeof(REBUNI)) == 0)
+				return i;
+		}
+	}
+	else {
+		c = FOLD_UNI(pat[0]);
+		for (i = 0; i < len - last; i++) {
+			if (FOLD_UNI(up[i]) != c) continue;
+			for (n = 1; n < plen; n++) {
+				if (FOLD_UNI(up[i + n]) != FOLD_UNI(pat[n])) break;
+			}
+			if (n == plen) return i;
+		}
+	}
+
+	return NOT_FOUND;
+}
+
+
 /***********************************************************************
 **
 */	REBCNT Find_Byte_Str(REBSER *series, REBCNT index, REBYTE *b2, REBCNT l2, REBFLG uncase, REBFLG match)
@@ -306,50 +458,25 @@
 ***********************************************************************/
 {
 	REBYTE *b1;
-	REBYTE *e1;
-	REBCNT l1;
-	REBYTE c;
 	REBCNT n;
 
 	// The pattern empty or is longer than the target:
 	if (l2 == 0 || (l2 + index) > SERIES_TAIL(series)) return NOT_FOUND;
 
 	b1 = BIN_SKIP(series, index);
-	l1 = SERIES_TAIL(series) - index;
-
-	e1 = b1 + (match ? 1 : l1 - (l2 - 1));
-
-	c = *b2; // first char
-
-	if (!uncase) {
-
-		while (b1 != e1) {
-			if (*b1 == c) { // matched first char
-				for (n = 1; n < l2; n++) {
-					if (b1[n] != b2[n]) break;
-				}
-				if (n == l2) return (b1 - BIN_HEAD(series));
-			}
-			b1++;
-		}
 
-	} else {
-
-		c = (REBYTE)LO_CASE(c); // OK! (never > 255)
+	if (!match) {
+		n = Find_Bytes(b1, SERIES_TAIL(series) - index, b2, l2, uncase);
+		return (n == NOT_FOUND) ? NOT_FOUND : index + n;
+	}
 
-		while (b1 != e1) {
-			if (LO_CASE(*b1) == c) { // matched first char
-				for (n = 1; n < l2; n++) {
-					if (LO_CASE(b1[n]) != LO_CASE(b2[n])) break;
-				}
-				if (n == l2) return (b1 - BIN_HEAD(series));
-			}
-			b1++;
-		}
+	if (!uncase) return (memcmp(b1, b2, l2) == 0) ? index : NOT_FOUND;
 
+	for (n = 0; n < l2; n++) {
+		if (LO_CASE(b1[n]) != LO_CASE(b2[n])) return NOT_FOUND;
 	}
 
-	return NOT_FOUND;
+	return index;
 }
 
 
@@ -365,6 +492,9 @@
 **
 **		Flags are set according to ALL_FIND_REFS
 **
+**		Forward scans of same-width strings go to Find_Bytes or
+**		Find_Unis, and the match must then end by the tail.
+**
 ***********************************************************************/
 {
 	REBUNI c1;
@@ -373,6 +503,17 @@
 	REBCNT n = 0;
 	REBOOL uncase = !(flags & AM_FIND_CASE); // uncase = case insenstive
 
+	if (skip == 1 && !(flags & AM_FIND_MATCH) && BYTE_SIZE(ser1) == BYTE_SIZE(ser2)) {
+		if (index >= tail) return NOT_FOUND;
+		if (BYTE_SIZE(ser1))
+			n = Find_Bytes(BIN_SKIP(ser1, index), tail - index, BIN_SKIP(ser2, index2), len, uncase);
+		else
+			n = Find_Unis(UNI_SKIP(ser1, index), tail - index, UNI_SKIP(ser2, index2), len, uncase);
+		if (n == NOT_FOUND) return NOT_FOUND;
+		if (flags & AM_FIND_TAIL) return index + n + len;
+		return index + n;
+	}
+
 	c2 = GET_ANY_CHAR(ser2, index2); // starting char
 	if (uncase && c2 < UNICODE_CASES) c2 = LO_CASE(c2);
 
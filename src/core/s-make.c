@@ -570,6 +570,13 @@ cp_same:
 
 	if (len < 0) len = LEN_BYTES(src);
 
+	// ASCII goes straight into a byte-sized string, no decoding needed:
+	if ((!dst || BYTE_SIZE(dst)) && Len_ASCII(src, len) == cast(REBCNT, len)) {
+		if (!dst) return Copy_Bytes(src, len);
+		Append_Series(dst, src, len);
+		return dst;
+	}
+
 	Resize_Series(ser, len+1); // needs at most this much
 
 	len = Decode_UTF8(UNI_HEAD(ser), src, len, FALSE);
@@ -40,10 +40,7 @@
 **
 ***********************************************************************/
 {
-	for (; len > 0; len--, bp++)
-		if (*bp >= 0x80) return FALSE;
-
-	return TRUE;
+	return Len_ASCII(bp, len) == len;
 }
 
 
@@ -734,6 +734,30 @@ ConversionResult ConvertUTF8toUTF32 (
 	return 0;
 }
 
+
+/***********************************************************************
+**
+*/	REBCNT Len_ASCII(const REBYTE *bp, REBCNT len)
+/*
+**		Returns how many bytes at the head of the string are ASCII.
+**		Checks eight bytes at a time, since text is usually ASCII
+**		and such a run is valid UTF-8 and latin-1 as it stands.
+**
+***********************************************************************/
+{
+	const REBYTE *start = bp;
+	REBU64 bits;
+
+	for (; len >= 8; len -= 8, bp += 8) {
+		memcpy(&bits, bp, 8);
+		if (bits & U64_C(0x8080808080808080)) break;
+	}
+
+	for (; len > 0 && *bp < 0x80; len--, bp++);
+
+	return bp - start;
+}
+
 /***********************************************************************
 **
 */	REBFLG Legal_UTF8_Char(const REBYTE *str, REBCNT len)
@@ -945,6 +969,31 @@ ConversionResult ConvertUTF8toUTF32 (
 		}
 	}
 
+	// ASCII is already in the byte-sized string form, so it can skip
+	// decoding to the wide buffer (and narrowing back).  Only the CR
+	// conversion is needed:
+	if ((utf == 0 || utf == 8) && Len_ASCII(bp, len) == len) {
+		REBYTE *cr = cast(REBYTE*, memchr(bp, CR, len));
+		REBYTE *dp;
+
+		if (!cr) return Copy_Bytes(bp, len);
+
+		dst = Make_Binary(len);
+		dp = BIN_HEAD(dst);
+		memcpy(dp, bp, cr - bp);
+		dp += cr - bp;
+		for (len -= cr - bp, bp = cr; len > 0; len--, bp++) {
+			if (*bp == CR) {
+				if (len > 1 && bp[1] == LF) continue;
+				*dp++ = LF;
+			}
+			else *dp++ = *bp;
+		}
+		SERIES_TAIL(dst) = dp - BIN_HEAD(dst);
+		TERM_SERIES(dst);
+		return dst;
+	}
+
 	if (utf == 0 || utf == 8) {
 		size = Decode_UTF8((REBUNI*)Reset_Buffer(ser, len), bp, len, TRUE);
 	}
@@ -1065,6 +1114,16 @@ ConversionResult ConvertUTF8toUTF32 (
 	if (len) cnt = *len;
 	else cnt = uni ? Strlen_Uni(up) : LEN_BYTES(bp);
 
+	// A leading run of ASCII bytes needs no encoding:
+	if (!uni && !ccr && max > 0) {
+		n = Len_ASCII(bp, MIN(cnt, cast(REBCNT, max)));
+		memcpy(dst, bp, n);
+		dst += n;
+		bp += n;
+		max -= n;
+		cnt -= n;
+	}
+
 	for (; max > 0 && cnt > 0; cnt--) {
 		c = uni ? *up++ : *bp++;
 		if (c < 0x80) {
@@ -31,8 +31,6 @@
 
 #define MAX_BITSET 0x7fffffff
 
-#define BITS_NOT(s) ((s)->extra.size)
-
 /***********************************************************************
 **
 */	REBINT CT_Bitset(REBVAL *a, REBVAL *b, REBINT mode)
@@ -584,6 +582,7 @@ set_bits:
 		raise Error_Invalid_Arg(arg);
 
 	case A_REMOVE:	// #"a" "abc"  remove/part bs "abcd"  yuk: /part ?
+		if (D_REF(4)) raise Error_0(RE_BAD_REFINES); // /key is for maps
 		if (!D_REF(2)) raise Error_0(RE_MISSING_ARG); // /part required
 		if (Set_Bits(VAL_SERIES(value), D_ARG(3), FALSE)) break;
 		raise Error_Invalid_Arg(D_ARG(3));
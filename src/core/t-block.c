@@ -31,8 +31,8 @@
 
 
 // !!! Should there be a qsort header so we don't redefine it here?
-typedef int cmp_t(const void *, const void *);
-extern void reb_qsort(void *a, size_t n, size_t es, cmp_t *cmp);
+typedef int cmp_t(void *, const void *, const void *);
+extern void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
 
 
 /***********************************************************************
@@ -287,34 +287,39 @@ done:
 	return;
 }
 
-// WARNING! Not re-entrant. !!!  Must find a way to push it on stack?
-// Fields initialized to zero due to global scope
-static struct {
+// Fewest records for which the radix sort is used:
+#define MIN_RADIX_SORT 64
+
+// Sort settings are passed to the comparators rather than kept in a
+// static, so a /compare function can itself call SORT.
+typedef struct reb_sort {
 	REBFLG cased;
 	REBFLG reverse;
 	REBCNT offset;
 	REBVAL *compare;
-} sort_flags;
+} REBSORT;
 
 /***********************************************************************
 **
-*/	static int Compare_Val(const void *v1, const void *v2)
+*/	static int Compare_Val(void *thunk, const void *v1, const void *v2)
 /*
 ***********************************************************************/
 {
+	REBSORT *sort_flags = cast(REBSORT*, thunk);
+
 	// !!!! BE SURE that 64 bit large difference comparisons work
 
-	if (sort_flags.reverse)
+	if (sort_flags->reverse)
 		return Cmp_Value(
-			cast(const REBVAL*, v2) + sort_flags.offset,
-			cast(const REBVAL*, v1) + sort_flags.offset,
-			sort_flags.cased
+			cast(const REBVAL*, v2) + sort_flags->offset,
+			cast(const REBVAL*, v1) + sort_flags->offset,
+			sort_flags->cased
 		);
 	else
 		return Cmp_Value(
-			cast(const REBVAL*, v1) + sort_flags.offset,
-			cast(const REBVAL*, v2) + sort_flags.offset,
-			sort_flags.cased
+			cast(const REBVAL*, v1) + sort_flags->offset,
+			cast(const REBVAL*, v2) + sort_flags->offset,
+			sort_flags->cased
 		);
 
 /*
@@ -328,10 +333,11 @@ static struct {
 
 /***********************************************************************
 **
-*/	static int Compare_Call(const void *v1, const void *v2)
+*/	static int Compare_Call(void *thunk, const void *v1, const void *v2)
 /*
 ***********************************************************************/
 {
+	REBSORT *sort_flags = cast(REBSORT*, thunk);
 	REBVAL *args = NULL;
 	REBVAL out;
 
@@ -339,17 +345,17 @@ static struct {
 
 	const void *tmp = NULL;
 
-	if (!sort_flags.reverse) { /*swap v1 and v2 */
+	if (!sort_flags->reverse) { /*swap v1 and v2 */
 		tmp = v1;
 		v1 = v2;
 		v2 = tmp;
 	}
 
-	args = BLK_SKIP(VAL_FUNC_PARAMLIST(sort_flags.compare), 1);
+	args = BLK_SKIP(VAL_FUNC_PARAMLIST(sort_flags->compare), 1);
 	if (NOT_END(args) && !TYPE_CHECK(args, VAL_TYPE(cast(const REBVAL*, v1)))) {
 		raise Error_3(
 			RE_EXPECT_ARG,
-			Type_Of(sort_flags.compare),
+			Type_Of(sort_flags->compare),
 			args,
 			Type_Of(cast(const REBVAL*, v1))
 		);
@@ -358,13 +364,13 @@ static struct {
 	if (NOT_END(args) && !TYPE_CHECK(args, VAL_TYPE(cast(const REBVAL*, v2)))) {
 		raise Error_3(
 			RE_EXPECT_ARG,
-			Type_Of(sort_flags.compare),
+			Type_Of(sort_flags->compare),
 			args,
 			Type_Of(cast(const REBVAL*, v2))
 		);
 	}
 
-	if (Apply_Func_Throws(&out, sort_flags.compare, v1, v2, 0))
+	if (Apply_Func_Throws(&out, sort_flags->compare, v1, v2, 0))
 		raise Error_No_Catch_For_Throw(&out);
 
 	if (IS_LOGIC(&out)) {
@@ -384,6 +390,147 @@ static struct {
 }
 
 
+/***********************************************************************
+**
+*/	static int Compare_String_Key(void *thunk, const void *v1, const void *v2)
+/*
+**		Compare_Val when every key is the same string type.
+**
+***********************************************************************/
+{
+	REBSORT *sort_flags = cast(REBSORT*, thunk);
+	const void *tmp;
+
+	if (sort_flags->reverse) {
+		tmp = v1;
+		v1 = v2;
+		v2 = tmp;
+	}
+
+	return Compare_String_Vals(
+		cast(const REBVAL*, v1) + sort_flags->offset,
+		cast(const REBVAL*, v2) + sort_flags->offset,
+		(REBOOL)!sort_flags->cased
+	);
+}
+
+
+/***********************************************************************
+**
+*/	static void Radix_Sort_Records(REBVAL *data, REBCNT len, REBCNT skip, REBU64 *keys, REBU64 *keys2, REBVAL *data2)
+/*
+**		LSD radix sort of records by unsigned 64-bit keys, one byte
+**		per pass. Passes where every key has the same byte are left
+**		out. Records with equal keys keep their order (stable).
+**
+***********************************************************************/
+{
+	REBCNT count[256];
+	REBCNT shift;
+	REBCNT sum;
+	REBCNT n;
+	REBCNT c;
+	REBU64 *k_in = keys;
+	REBU64 *k_out = keys2;
+	REBU64 *k_tmp;
+	REBVAL *d_in = data;
+	REBVAL *d_out = data2;
+	REBVAL *d_tmp;
+
+	for (shift = 0; shift < 64; shift += 8) {
+		CLEAR(count, sizeof(count));
+		for (n = 0; n < len; n++) count[(k_in[n] >> shift) & 0xff]++;
+		if (count[(k_in[0] >> shift) & 0xff] == len) continue;
+
+		for (sum = 0, c = 0; c < 256; c++) {
+			n = count[c];
+			count[c] = sum;
+			sum += n;
+		}
+
+		for (n = 0; n < len; n++) {
+			c = count[(k_in[n] >> shift) & 0xff]++;
+			k_out[c] = k_in[n];
+			memcpy(d_out + c * skip, d_in + n * skip, skip * sizeof(REBVAL));
+		}
+
+		k_tmp = k_in, k_in = k_out, k_out = k_tmp;
+		d_tmp = d_in, d_in = d_out, d_out = d_tmp;
+	}
+
+	if (d_in != data) memcpy(data, d_in, len * skip * sizeof(REBVAL));
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Radix_Sort_Block(REBSORT *sort_flags, REBVAL *data, REBCNT len, REBCNT skip)
+/*
+**		Sort records whose keys are all INTEGER!, all DECIMAL!, all
+**		TIME! or all DATE! with a radix sort. Each key becomes an
+**		unsigned 64-bit number in the same order as Cmp_Value. A date
+**		takes two passes: by time of day, then by day.
+**
+**		Returns FALSE (without sorting) for any other keys.
+**
+***********************************************************************/
+{
+	const REBU64 sign = U64_C(0x8000000000000000);
+	enum Reb_Kind kind = VAL_TYPE(data + sort_flags->offset);
+	REBVAL *val;
+	REBU64 *keys;
+	REBU64 *keys2;
+	REBVAL *data2;
+	REBU64 key;
+	REBI64 t;
+	REBCNT pass;
+	REBCNT n;
+
+	if (kind != REB_INTEGER && kind != REB_DECIMAL && kind != REB_TIME && kind != REB_DATE)
+		return FALSE;
+
+	for (n = 1; n < len; n++) {
+		if (VAL_TYPE(data + n * skip + sort_flags->offset) != kind) return FALSE;
+	}
+
+	keys = ALLOC_ARRAY(REBU64, len);
+	keys2 = ALLOC_ARRAY(REBU64, len);
+	data2 = ALLOC_ARRAY(REBVAL, len * skip);
+
+	for (pass = 0; pass < ((kind == REB_DATE) ? 2 : 1); pass++) {
+		for (n = 0; n < len; n++) {
+			val = data + n * skip + sort_flags->offset;
+			switch (kind) {
+			case REB_INTEGER:
+				key = cast(REBU64, VAL_INT64(val)) ^ sign;
+				break;
+			case REB_DECIMAL:
+				memcpy(&key, &VAL_DECIMAL(val), sizeof(key));
+				key = (key & sign) ? ~key : (key | sign);
+				break;
+			default: // time, or a date's time then day
+				if (pass == 0) {
+					t = VAL_TIME(val);
+					if (t == NO_TIME) t = 0;
+					key = cast(REBU64, t) ^ sign;
+				}
+				else
+					key = (VAL_YEAR(val) << 9) | (VAL_MONTH(val) << 5) | VAL_DAY(val);
+				break;
+			}
+			keys[n] = sort_flags->reverse ? ~key : key;
+		}
+		Radix_Sort_Records(data, len, skip, keys, keys2, data2);
+	}
+
+	FREE_ARRAY(REBU64, len, keys);
+	FREE_ARRAY(REBU64, len, keys2);
+	FREE_ARRAY(REBVAL, len * skip, data2);
+
+	return TRUE;
+}
+
+
 /***********************************************************************
 **
 */	static void Sort_Block(REBVAL *block, REBFLG ccase, REBVAL *skipv, REBVAL *compv, REBVAL *part, REBFLG all, REBFLG rev)
@@ -404,6 +551,7 @@ static struct {
 	REBCNT len;
 	REBCNT skip = 1;
 	REBCNT size = sizeof(REBVAL);
+	REBSORT sort_flags;
 //	int (*sfunc)(const void *v1, const void *v2);
 
 	sort_flags.cased = ccase;
@@ -428,10 +576,32 @@ static struct {
 	// Use fast quicksort library function:
 	if (skip > 1) len /= skip, size *= skip;
 
-	if (sort_flags.compare)
-		reb_qsort(VAL_BLK_DATA(block), len, size, Compare_Call);
-	else
-		reb_qsort(VAL_BLK_DATA(block), len, size, Compare_Val);
+	if (sort_flags.compare) {
+		reb_qsort_r(VAL_BLK_DATA(block), len, size, &sort_flags, Compare_Call);
+		return;
+	}
+
+	// Keys of one type can skip the generic Cmp_Value:
+	if (sort_flags.offset < skip) {
+		REBVAL *data = VAL_BLK_DATA(block);
+		enum Reb_Kind kind = VAL_TYPE(data + sort_flags.offset);
+		REBCNT n;
+
+		if (len >= MIN_RADIX_SORT && Radix_Sort_Block(&sort_flags, data, len, skip))
+			return;
+
+		if (kind >= REB_STRING && kind <= REB_TAG) {
+			for (n = 1; n < len; n++) {
+				if (VAL_TYPE(data + n * skip + sort_flags.offset) != kind) break;
+			}
+			if (n == len) {
+				reb_qsort_r(data, len, size, &sort_flags, Compare_String_Key);
+				return;
+			}
+		}
+	}
+
+	reb_qsort_r(VAL_BLK_DATA(block), len, size, &sort_flags, Compare_Val);
 
 }
 
@@ -703,6 +873,7 @@ zero_blk:
 	case A_FIND:
 	case A_SELECT:
 		args = Find_Refines(call_, ALL_FIND_REFS);
+		if (args & AM_FIND_SORTED) raise Error_0(RE_BAD_REFINES);
 //		if (ANY_BLOCK(arg) || args) {
 			len = ANY_BLOCK(arg) ? VAL_BLK_LEN(arg) : 1;
 			if (args & AM_FIND_PART) tail = Partial1(value, D_ARG(ARG_FIND_LIMIT));
@@ -850,6 +850,7 @@ is_none:
 
 	case A_REMOVE:
 		// /PART length
+		if (D_REF(4)) raise Error_0(RE_BAD_REFINES); // /KEY is for maps
 		len = D_REF(2) ? Get_Num_Arg(D_ARG(3)) : 1;
 		if (index + len > tail) len = tail - index;
 		if (index < tail && len != 0) Remove_Gobs(gob, index, len);
@@ -961,6 +961,7 @@ find_none:
 		break;
 
 	case A_REMOVE:	// remove series /part count
+		if (D_REF(4)) raise Error_0(RE_BAD_REFINES); // /key is for maps
 		if (D_REF(2)) {
 			val = D_ARG(3);
 			if (IS_INTEGER(val)) {
@@ -49,6 +49,13 @@
 
 	The hash-series/tail is a prime number that is use for computing
 	slots in the hash table.
+
+	A key is removed by setting its value to NONE.  Its entry (and its
+	hash slot, which other keys may probe through) stays until a new key
+	is added and the map or its hash table would have to grow for it.
+	Then Compact_Map drops the removed entries if there are enough of
+	them, and rebuilds the hash (shrinking it if it has become much
+	larger than needed).  Setting a key that exists never moves entries.
 */
 
 #include "sys-core.h"
@@ -114,13 +121,12 @@
 
 	// Compute hash for value:
 	len = hser->tail;
-	hash = Hash_Value(key, len);
+	hash = Hash_Value(key);
 	if (!hash) raise Error_Has_Bad_Type(key);
 
 	// Determine skip and first index:
-	skip  = (len == 0) ? 0 : (hash & 0x0000FFFF) % len;
-	if (skip == 0) skip = 1;
-	hash = (len == 0) ? 0 : (hash & 0x00FFFF00) % len;
+	skip = (len < 2) ? 1 : HASH_SKIP(hash, len);
+	hash = (len == 0) ? 0 : HASH_SLOT(hash, len);
 
 	// Scan hash table for match:
 	hashes = (REBCNT*)hser->data;
@@ -192,13 +198,66 @@
 }
 
 
+/***********************************************************************
+**
+*/	static REBCNT Compact_Map(REBSER *series)
+/*
+**		Drop the entries of removed keys (NONE values) if they are a
+**		quarter or more of the map, so a map used as a cache reuses
+**		their space rather than growing.  Rehashes what remains, in
+**		a smaller hash table if it no longer needs half of it.
+**
+**		RETURNS: the number of entries dropped.
+**
+***********************************************************************/
+{
+	REBVAL *src;
+	REBVAL *dst;
+	REBCNT dead = 0;
+	REBCNT n;
+
+	src = BLK_HEAD(series);
+	for (n = 0; n < series->tail; n += 2, src += 2) {
+		if (IS_NONE(src+1)) dead++;
+	}
+
+	if (dead == 0 || dead * 4 < series->tail / 2) return 0;
+
+	dst = src = BLK_HEAD(series);
+	for (n = 0; n < series->tail; n += 2, src += 2) {
+		if (IS_NONE(src+1)) continue;
+		if (dst != src) {
+			dst[0] = src[0];
+			dst[1] = src[1];
+		}
+		dst += 2;
+	}
+	series->tail = dst - BLK_HEAD(series);
+	BLK_TERM(series);
+
+	if (series->extra.series) {
+		REBSER *hser = series->extra.series;
+		REBCNT pnum = Get_Hash_Prime(series->tail * 2); // as Make_Hash_Sequence
+
+		if (pnum && pnum * 2 < hser->tail) {
+			Remake_Series(hser, pnum + 1, SERIES_WIDE(hser), MKS_POWER_OF_2);
+			hser->tail = pnum;
+		}
+		CLEAR_SERIES(hser);
+		Rehash_Hash(series);
+	}
+
+	return dead;
+}
+
+
 /***********************************************************************
 **
 */	static REBCNT Find_Entry(REBSER *series, REBVAL *key, REBVAL *val)
 /*
 **		Try to find the entry in the map. If not found
 **		and val is SET, create the entry and store the key and
-**		val.
+**		val.  (Setting NONE for a key not in the map adds nothing.)
 **
 **		RETURNS: the index to the VALUE or zero if there is none.
 **
@@ -257,7 +316,7 @@
 			else
 				raise Error_Has_Bad_Type(key);
 
-			if (!val) return 0;
+			if (!val || IS_NONE(val)) return 0;
 			Append_Value(series, key);
 			Append_Value(series, val); // does not copy value, e.g. if string
 			return series->tail/2;
@@ -270,12 +329,6 @@
 		Rehash_Hash(series);
 	}
 
-	// Get hash table, expand it if needed:
-	if (series->tail > hser->tail/2) {
-		Expand_Hash(hser); // modifies size value
-		Rehash_Hash(series);
-	}
-
 	hash = Find_Key(series, hser, key, 2, 0, 0);
 	hashes = (REBCNT*)hser->data;
 	n = hashes[hash];
@@ -289,7 +342,20 @@
 		return n;
 	}
 
-	// Create new entry:
+	// Create new entry.  If the block or its hash table would have to
+	// grow, first see if dropping removed entries makes room (the table
+	// counts them, and a cache map would otherwise keep growing).  This
+	// only happens here, so setting existing keys never moves entries.
+	if (IS_NONE(val)) return 0;
+	if (SERIES_AVAIL(series) < 2 || series->tail > hser->tail/2) {
+		Compact_Map(series);
+		if (series->tail > hser->tail/2) {
+			Expand_Hash(hser); // modifies size value
+			Rehash_Hash(series);
+		}
+		hash = Find_Key(series, hser, key, 2, 0, 0);
+		hashes = (REBCNT*)hser->data; // table may have changed size
+	}
 	Append_Value(series, key);
 	Append_Value(series, val);  // does not copy value, e.g. if string
 
@@ -343,8 +409,10 @@
 
 /***********************************************************************
 **
-*/	static void Append_Map(REBSER *ser, REBVAL *arg, REBCNT len)
+*/	void Append_Map(REBSER *ser, REBVAL *arg, REBCNT len)
 /*
+**		Add up to len keys and values from a block to the map.
+**
 ***********************************************************************/
 {
 	REBVAL *val;
@@ -521,6 +589,14 @@
 		Append_Map(series, arg, Partial1(arg, D_ARG(AN_LIMIT)));
 		break;
 
+	case A_REMOVE:
+		if (D_REF(2)) raise Error_0(RE_BAD_REFINES); // no /PART for maps
+		if (!D_REF(4)) raise Error_Illegal_Action(REB_MAP, action);
+		n = Find_Entry(series, D_ARG(5), 0);
+		if (n) SET_NONE(BLK_SKIP(series, ((n-1)*2)+1));
+		*D_OUT = *val;
+		break;
+
 	case A_POKE:  // CHECK all pokes!!! to be sure they check args now !!!
 		n = Find_Entry(series, arg, D_ARG(3));
 		*D_OUT = *D_ARG(3);
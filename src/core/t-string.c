@@ -34,8 +34,8 @@
 
 
 // !!! Should there be a qsort header so we don't redefine it here?
-typedef int cmp_t(const void *, const void *);
-extern void reb_qsort(void *a, size_t n, size_t es, cmp_t *cmp);
+typedef int cmp_t(void *, const void *, const void *);
+extern void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
 
 
 /***********************************************************************
@@ -260,6 +260,11 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 		ser = Copy_Bytes(VAL_BIN(arg), VAL_TAIL(arg));
 		break;
 
+	// MAKE/TO BINARY! <vector!> (its numbers' bytes, in memory order)
+	case REB_VECTOR:
+		ser = Copy_Bytes(VAL_DATA(arg), VAL_LEN(arg) * SERIES_WIDE(VAL_SERIES(arg)));
+		break;
+
 	// MAKE/TO BINARY! <image!>
 	case REB_IMAGE:
 	  	ser = Make_Image_Binary(arg);
@@ -299,7 +304,7 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 
 /***********************************************************************
 **
-*/	static int Compare_Chr(const void *v1, const void *v2)
+*/	static int Compare_Chr(void *thunk, const void *v1, const void *v2)
 /*
 ***********************************************************************/
 {
@@ -310,7 +315,7 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 
 /***********************************************************************
 **
-*/	static int Compare_Chr_Rev(const void *v1, const void *v2)
+*/	static int Compare_Chr_Rev(void *thunk, const void *v1, const void *v2)
 /*
 ***********************************************************************/
 {
@@ -319,6 +324,37 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 }
 
 
+/***********************************************************************
+**
+*/	static void Count_Sort_Bytes(REBYTE *bp, REBCNT len, REBFLG rev)
+/*
+**		Sort single bytes by counting them. Linear in the length,
+**		so large binaries and byte strings don't pay for qsort.
+**
+***********************************************************************/
+{
+	REBCNT counts[256];
+	REBCNT n;
+	REBINT c;
+
+	CLEARS(&counts);
+	for (n = 0; n < len; n++) counts[bp[n]]++;
+
+	if (rev) {
+		for (c = 255; c >= 0; c--) {
+			memset(bp, c, counts[c]);
+			bp += counts[c];
+		}
+	}
+	else {
+		for (c = 0; c < 256; c++) {
+			memset(bp, c, counts[c]);
+			bp += counts[c];
+		}
+	}
+}
+
+
 /***********************************************************************
 **
 */	static void Sort_String(REBVAL *string, REBFLG ccase, REBVAL *skipv, REBVAL *compv, REBVAL *part, REBFLG all, REBFLG rev)
@@ -328,7 +364,7 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 	REBCNT len;
 	REBCNT skip = 1;
 	REBCNT size = 1;
-	int (*sfunc)(const void *v1, const void *v2);
+	cmp_t *sfunc;
 
 	// Determine length of sort:
 	len = Partial(string, 0, part, 0);
@@ -345,8 +381,13 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 	if (skip > 1) len /= skip, size *= skip;
 	sfunc = rev ? Compare_Chr_Rev : Compare_Chr;
 
+	if (size == 1 && BYTE_SIZE(VAL_SERIES(string))) {
+		Count_Sort_Bytes(VAL_BIN_DATA(string), len, rev);
+		return;
+	}
+
 	//!!uni - needs to compare wide chars too
-	reb_qsort(VAL_DATA(string), len, size * SERIES_WIDE(VAL_SERIES(string)), sfunc);
+	reb_qsort_r(VAL_DATA(string), len, size * SERIES_WIDE(VAL_SERIES(string)), NULL, sfunc);
 }
 
 
@@ -508,6 +549,7 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 		ret = ALL_FIND_REFS;
 find:
 		args = Find_Refines(call_, ret);
+		if (args & AM_FIND_SORTED) raise Error_0(RE_BAD_REFINES);
 
 		if (IS_BINARY(value)) {
 			args |= AM_FIND_CASE;
@@ -243,6 +243,14 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 	if ((b1 >= VTSF08 && b2 < VTSF08) || (b2 >= VTSF08 && b1 < VTSF08))
 		raise Error_0(RE_NOT_SAME_TYPE);
 
+	// Same types compare equal when their bytes do (vectors are often
+	// compared just for equality), otherwise find where they differ:
+	if (b1 == b2 && 0 == memcmp(
+		d1 + VAL_INDEX(v1) * SERIES_WIDE(VAL_SERIES(v1)),
+		d2 + VAL_INDEX(v2) * SERIES_WIDE(VAL_SERIES(v2)),
+		len * SERIES_WIDE(VAL_SERIES(v1))
+	)) return l1 - l2;
+
 	for (n = 0; n < len; n++) {
 		i1 = get_vect(b1, d1, n + VAL_INDEX(v1));
 		i2 = get_vect(b2, d2, n + VAL_INDEX(v2));
@@ -528,6 +536,499 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 }
 
 
+/***********************************************************************
+**
+*/	static REBDEC Get_Vect_Decimal(REBCNT bits, REBYTE *data, REBCNT n)
+/*
+**		Get a vector element of any type as a decimal.
+**
+***********************************************************************/
+{
+	union {REBU64 i; REBDEC d;} v;
+
+	v.i = get_vect(bits, data, n);
+	if (bits >= VTSF08) return v.d;
+	if (bits >= VTUI08) return cast(REBDEC, v.i);
+	return cast(REBDEC, cast(REBI64, v.i));
+}
+
+
+// Element-wise math is written out once per element type, so that the
+// compiler can vectorize each loop. Integers are computed in the unsigned
+// type U and wrap at their width, the same as storing them with set_vect.
+
+#define VECT_EACH(T, EXPR) \
+	if (bp) { \
+		const T *b = cast(const T*, bp); \
+		for (n = 0; n < len; n++) { T x = a[n]; T y = b[n]; out[n] = (EXPR); } \
+	} \
+	else { \
+		for (n = 0; n < len; n++) { T x = a[n]; T y = k; out[n] = (EXPR); } \
+	}
+
+#define VECT_MATH(T, U, SIGNED, SCALAR) { \
+	T *out = cast(T*, dp); \
+	const T *a = cast(const T*, ap); \
+	T k = cast(T, SCALAR); \
+	if (!bp && action == A_DIVIDE && SCALAR == 0) raise Error_0(RE_ZERO_DIVIDE); \
+	switch (action) { \
+	case A_ADD: \
+		VECT_EACH(T, cast(T, cast(U, x) + cast(U, y))); break; \
+	case A_SUBTRACT: \
+		VECT_EACH(T, cast(T, cast(U, x) - cast(U, y))); break; \
+	case A_MULTIPLY: \
+		VECT_EACH(T, cast(T, cast(U, x) * cast(U, y))); break; \
+	case A_DIVIDE: \
+		VECT_EACH(T, (SIGNED && y == cast(T, -1)) \
+			? cast(T, 0 - cast(U, x)) : cast(T, x / y)); break; \
+	} \
+}
+
+
+/***********************************************************************
+**
+*/	static void Math_Vector(REBVAL *out, REBVAL *value, REBVAL *arg, REBCNT action)
+/*
+**		ADD, SUBTRACT, MULTIPLY or DIVIDE a vector by a vector of the
+**		same length or by a number, giving a new vector of the first
+**		vector's type.
+**
+***********************************************************************/
+{
+	REBSER *vect = VAL_SERIES(value);
+	REBCNT type = VECT_TYPE(vect);
+	REBCNT len = VAL_LEN(value);
+	REBCNT btype = type;
+	REBYTE *ap = VAL_DATA(value);
+	REBYTE *bp = NULL;
+	REBYTE *dp;
+	REBI64 si = 0;
+	REBDEC sf = 0;
+	REBSER *ser;
+	REBCNT n;
+
+	if (IS_VECTOR(arg)) {
+		if (VAL_LEN(arg) != len) raise Error_Invalid_Arg(arg);
+		bp = VAL_DATA(arg);
+		btype = VECT_TYPE(VAL_SERIES(arg));
+		if (action == A_DIVIDE) {
+			for (n = 0; n < len; n++)
+				if (Get_Vect_Decimal(btype, bp, n) == 0)
+					raise Error_0(RE_ZERO_DIVIDE);
+		}
+	}
+	else if (IS_INTEGER(arg)) {
+		si = VAL_INT64(arg);
+		sf = cast(REBDEC, si);
+	}
+	else if (IS_DECIMAL(arg) || IS_PERCENT(arg)) {
+		sf = VAL_DECIMAL(arg);
+		// Scale integers by a fraction through the element-wise path:
+		if (type < VTSF08) btype = VTSF64;
+	}
+	else raise Error_Math_Args(VAL_TYPE(arg), action);
+
+	ser = Make_Vector(
+		(type >> 3) & 1, (type >> 2) & 1, 1, bit_sizes[type & 3], len
+	);
+	dp = ser->data;
+
+	if (btype == type && !bp && action == A_DIVIDE && type < VTSF08) {
+		// Divide by the full 64-bit scalar, not one cut down to the element
+		// width. A divisor beyond the element range leaves zero.
+		REBU64 x, r;
+		if (si == 0) raise Error_0(RE_ZERO_DIVIDE);
+		for (n = 0; n < len; n++) {
+			x = get_vect(type, ap, n);
+			if (si == -1) r = 0 - x;
+			else if (type != VTUI64) r = cast(REBU64, cast(REBI64, x) / si);
+			else if (si > 0) r = x / cast(REBU64, si);
+			else r = 0 - (x / (0 - cast(REBU64, si)));
+			set_vect(type, dp, n, cast(REBI64, r), 0);
+		}
+	}
+	else if (btype == type) {
+		switch (type) {
+		case VTSI08: VECT_MATH(i8, REBCNT, 1, si); break;
+		case VTSI16: VECT_MATH(i16, REBCNT, 1, si); break;
+		case VTSI32: VECT_MATH(i32, u32, 1, si); break;
+		case VTSI64: VECT_MATH(i64, REBU64, 1, si); break;
+		case VTUI08: VECT_MATH(u8, REBCNT, 0, si); break;
+		case VTUI16: VECT_MATH(u16, REBCNT, 0, si); break;
+		case VTUI32: VECT_MATH(u32, u32, 0, si); break;
+		case VTUI64: VECT_MATH(u64, REBU64, 0, si); break;
+		case VTSF32: VECT_MATH(float, float, 0, sf); break;
+		case VTSF64: VECT_MATH(double, double, 0, sf); break;
+		}
+	}
+	else if (type < VTSF08 && btype < VTSF08) {
+		// Mixed integer widths, done at 64 bits and then stored:
+		REBU64 x, y, r = 0;
+		for (n = 0; n < len; n++) {
+			x = get_vect(type, ap, n);
+			y = get_vect(btype, bp, n);
+			switch (action) {
+			case A_ADD: r = x + y; break;
+			case A_SUBTRACT: r = x - y; break;
+			case A_MULTIPLY: r = x * y; break;
+			case A_DIVIDE:
+				if (type == VTUI64 || btype == VTUI64) r = x / y;
+				else if (cast(REBI64, y) == -1) r = 0 - x;
+				else r = cast(REBU64, cast(REBI64, x) / cast(REBI64, y));
+				break;
+			}
+			set_vect(type, dp, n, cast(REBI64, r), 0);
+		}
+	}
+	else {
+		// Mixed integers and decimals are done as decimals:
+		REBDEC x, y, r = 0;
+		for (n = 0; n < len; n++) {
+			x = Get_Vect_Decimal(type, ap, n);
+			y = bp ? Get_Vect_Decimal(btype, bp, n) : sf;
+			switch (action) {
+			case A_ADD: r = x + y; break;
+			case A_SUBTRACT: r = x - y; break;
+			case A_MULTIPLY: r = x * y; break;
+			case A_DIVIDE:
+				if (y == 0) raise Error_0(RE_ZERO_DIVIDE);
+				r = x / y;
+				break;
+			}
+			if (type < VTSF08) {
+				// Only decimals that fit the 64-bit integers can be stored:
+				if (!(r >= -9223372036854775808.0 && r < 18446744073709551616.0))
+					raise Error_0(RE_OVERFLOW);
+				if (r >= 9223372036854775808.0)
+					set_vect(type, dp, n, cast(REBI64, cast(REBU64, r)), r);
+				else
+					set_vect(type, dp, n, cast(REBI64, r), r);
+			}
+			else set_vect(type, dp, n, 0, r);
+		}
+	}
+
+	Val_Init_Vector(out, ser);
+}
+
+
+// Reductions keep four running totals, so the loop is not serialized on
+// a single accumulator. Integers total in 64 bits and wrap.
+
+#define VECT_TOTAL(T, ACC, TOTAL, EXPR) { \
+	const T *a = cast(const T*, ap); \
+	ACC s0 = 0, s1 = 0, s2 = 0, s3 = 0; \
+	for (n = 0; n + 4 <= len; n += 4) { \
+		s0 += EXPR(T, n); s1 += EXPR(T, n + 1); \
+		s2 += EXPR(T, n + 2); s3 += EXPR(T, n + 3); \
+	} \
+	for (; n < len; n++) s0 += EXPR(T, n); \
+	TOTAL = (s0 + s1) + (s2 + s3); \
+}
+
+#define VECT_SUM_I(T, i) cast(REBU64, a[i])
+#define VECT_SUM_F(T, i) cast(REBDEC, a[i])
+#define VECT_DOT_I(T, i) \
+	(cast(REBU64, a[i]) * cast(REBU64, cast(const T*, bp)[i]))
+#define VECT_DOT_F(T, i) \
+	(cast(REBDEC, a[i]) * cast(REBDEC, cast(const T*, bp)[i]))
+
+
+/***********************************************************************
+**
+*/	void Total_Vector(REBVAL *out, REBVAL *vect, REBVAL *vect2)
+/*
+**		Sum the numbers of a vector, or if a second vector is given,
+**		the products of their numbers (the dot product).
+**
+**		The result is an integer if both vectors hold integers,
+**		otherwise it is a decimal.
+**
+***********************************************************************/
+{
+	REBCNT type = VECT_TYPE(VAL_SERIES(vect));
+	REBCNT len = VAL_LEN(vect);
+	REBCNT btype = type;
+	REBYTE *ap = VAL_DATA(vect);
+	REBYTE *bp = ap;
+	REBU64 itotal = 0;
+	REBDEC ftotal = 0;
+	REBCNT n;
+
+	if (vect2) {
+		if (VAL_LEN(vect2) != len) raise Error_Invalid_Arg(vect2);
+		bp = VAL_DATA(vect2);
+		btype = VECT_TYPE(VAL_SERIES(vect2));
+	}
+
+	if (!vect2) {
+		switch (type) {
+		case VTSI08: VECT_TOTAL(i8, REBU64, itotal, VECT_SUM_I); break;
+		case VTSI16: VECT_TOTAL(i16, REBU64, itotal, VECT_SUM_I); break;
+		case VTSI32: VECT_TOTAL(i32, REBU64, itotal, VECT_SUM_I); break;
+		case VTSI64: VECT_TOTAL(i64, REBU64, itotal, VECT_SUM_I); break;
+		case VTUI08: VECT_TOTAL(u8, REBU64, itotal, VECT_SUM_I); break;
+		case VTUI16: VECT_TOTAL(u16, REBU64, itotal, VECT_SUM_I); break;
+		case VTUI32: VECT_TOTAL(u32, REBU64, itotal, VECT_SUM_I); break;
+		case VTUI64: VECT_TOTAL(u64, REBU64, itotal, VECT_SUM_I); break;
+		case VTSF32: VECT_TOTAL(float, REBDEC, ftotal, VECT_SUM_F); break;
+		case VTSF64: VECT_TOTAL(double, REBDEC, ftotal, VECT_SUM_F); break;
+		}
+	}
+	else if (btype == type) {
+		switch (type) {
+		case VTSI08: VECT_TOTAL(i8, REBU64, itotal, VECT_DOT_I); break;
+		case VTSI16: VECT_TOTAL(i16, REBU64, itotal, VECT_DOT_I); break;
+		case VTSI32: VECT_TOTAL(i32, REBU64, itotal, VECT_DOT_I); break;
+		case VTSI64: VECT_TOTAL(i64, REBU64, itotal, VECT_DOT_I); break;
+		case VTUI08: VECT_TOTAL(u8, REBU64, itotal, VECT_DOT_I); break;
+		case VTUI16: VECT_TOTAL(u16, REBU64, itotal, VECT_DOT_I); break;
+		case VTUI32: VECT_TOTAL(u32, REBU64, itotal, VECT_DOT_I); break;
+		case VTUI64: VECT_TOTAL(u64, REBU64, itotal, VECT_DOT_I); break;
+		case VTSF32: VECT_TOTAL(float, REBDEC, ftotal, VECT_DOT_F); break;
+		case VTSF64: VECT_TOTAL(double, REBDEC, ftotal, VECT_DOT_F); break;
+		}
+	}
+	else if (type < VTSF08 && btype < VTSF08) {
+		for (n = 0; n < len; n++)
+			itotal += get_vect(type, ap, n) * get_vect(btype, bp, n);
+	}
+	else {
+		for (n = 0; n < len; n++)
+			ftotal += Get_Vect_Decimal(type, ap, n)
+				* Get_Vect_Decimal(btype, bp, n);
+	}
+
+	if (type < VTSF08 && btype < VTSF08) {
+		SET_INTEGER(out, cast(REBI64, itotal));
+	}
+	else {
+		SET_DECIMAL(out, ftotal);
+	}
+}
+
+
+#define VECT_EXTREME(T) { \
+	const T *a = cast(const T*, ap); \
+	T m = a[0]; \
+	if (largest) { \
+		for (n = 1; n < len; n++) if (a[n] > m) m = a[n], at = n; \
+	} \
+	else { \
+		for (n = 1; n < len; n++) if (a[n] < m) m = a[n], at = n; \
+	} \
+}
+
+
+/***********************************************************************
+**
+*/	REBCNT Find_Vector_Extreme(REBVAL *vect, REBFLG largest)
+/*
+**		Return the offset of the first smallest (or largest) number
+**		in the vector, or zero if it is empty.
+**
+***********************************************************************/
+{
+	REBCNT type = VECT_TYPE(VAL_SERIES(vect));
+	REBCNT len = VAL_LEN(vect);
+	REBYTE *ap = VAL_DATA(vect);
+	REBCNT at = 0;
+	REBCNT n;
+
+	if (len == 0) return 0;
+
+	switch (type) {
+	case VTSI08: VECT_EXTREME(i8); break;
+	case VTSI16: VECT_EXTREME(i16); break;
+	case VTSI32: VECT_EXTREME(i32); break;
+	case VTSI64: VECT_EXTREME(i64); break;
+	case VTUI08: VECT_EXTREME(u8); break;
+	case VTUI16: VECT_EXTREME(u16); break;
+	case VTUI32: VECT_EXTREME(u32); break;
+	case VTUI64: VECT_EXTREME(u64); break;
+	case VTSF32: VECT_EXTREME(float); break;
+	case VTSF64: VECT_EXTREME(double); break;
+	}
+
+	return at;
+}
+
+
+/***********************************************************************
+**
+*/	static REBU64 Vect_Sort_Key(REBCNT type, REBU64 bits)
+/*
+**		Map a vector element (as from get_vect) to an unsigned key
+**		in the same order. Integer keys use only the element's width.
+**
+***********************************************************************/
+{
+	const REBU64 sign = U64_C(0x8000000000000000);
+	REBCNT width = bit_sizes[type & 3];
+	REBU64 mask = (width == 64) ? ~U64_C(0) : ((U64_C(1) << width) - 1);
+
+	if (type >= VTSF08) return (bits & sign) ? ~bits : (bits | sign);
+	if (type >= VTUI08) return bits & mask;
+	return (bits ^ (U64_C(1) << (width - 1))) & mask;
+}
+
+
+/***********************************************************************
+**
+*/	static REBU64 Vect_Sort_Bits(REBCNT type, REBU64 key)
+/*
+**		Reverse of Vect_Sort_Key, for set_vect.
+**
+***********************************************************************/
+{
+	const REBU64 sign = U64_C(0x8000000000000000);
+
+	if (type >= VTSF08) return (key & sign) ? (key ^ sign) : ~key;
+	if (type >= VTUI08) return key;
+	return key ^ (U64_C(1) << (bit_sizes[type & 3] - 1));
+}
+
+
+/***********************************************************************
+**
+*/	static void Sort_Vector(REBVAL *vect, REBCNT len, REBFLG rev)
+/*
+**		LSD radix sort of a vector's numbers, one byte per pass.
+**		Integers take one pass per byte of their width; passes where
+**		every key has the same byte are left out.
+**
+***********************************************************************/
+{
+	REBCNT type = VECT_TYPE(VAL_SERIES(vect));
+	REBCNT bytes = (type >= VTSF08) ? 8 : bit_sizes[type & 3] / 8;
+	REBYTE *data = VAL_DATA(vect);
+	union {REBU64 i; REBDEC d;} v;
+	REBCNT count[256];
+	REBU64 *keys;
+	REBU64 *keys2;
+	REBU64 *k_in;
+	REBU64 *k_out;
+	REBU64 *k_tmp;
+	REBCNT shift;
+	REBCNT sum;
+	REBCNT n;
+	REBCNT c;
+
+	if (len <= 1) return;
+
+	keys = ALLOC_ARRAY(REBU64, len);
+	keys2 = ALLOC_ARRAY(REBU64, len);
+
+	for (n = 0; n < len; n++)
+		keys[n] = Vect_Sort_Key(type, get_vect(type, data, n));
+
+	k_in = keys;
+	k_out = keys2;
+	for (shift = 0; shift < bytes * 8; shift += 8) {
+		CLEAR(count, sizeof(count));
+		for (n = 0; n < len; n++) count[(k_in[n] >> shift) & 0xff]++;
+		if (count[(k_in[0] >> shift) & 0xff] == len) continue;
+
+		for (sum = 0, c = 0; c < 256; c++) {
+			n = count[c];
+			count[c] = sum;
+			sum += n;
+		}
+
+		for (n = 0; n < len; n++)
+			k_out[count[(k_in[n] >> shift) & 0xff]++] = k_in[n];
+
+		k_tmp = k_in, k_in = k_out, k_out = k_tmp;
+	}
+
+	for (n = 0; n < len; n++) {
+		v.i = Vect_Sort_Bits(type, k_in[rev ? len - n - 1 : n]);
+		set_vect(type, data, n, cast(REBI64, v.i), v.d);
+	}
+
+	FREE_ARRAY(REBU64, len, keys);
+	FREE_ARRAY(REBU64, len, keys2);
+}
+
+
+#define VECT_FIND(T) { \
+	const T *a = cast(const T*, data); \
+	T k; \
+	memcpy(&k, &target, sizeof(k)); \
+	if (sorted) { \
+		REBCNT lo = index, hi = tail, mid; \
+		while (lo < hi) { \
+			mid = lo + (hi - lo) / 2; \
+			if (last ? !(k < a[mid]) : (a[mid] < k)) lo = mid + 1; \
+			else hi = mid; \
+		} \
+		if (last) { if (lo > index && a[lo - 1] == k) return lo - 1; } \
+		else if (lo < tail && a[lo] == k) return lo; \
+	} \
+	else if (last) { \
+		for (n = tail; n > index; n--) if (a[n - 1] == k) return n - 1; \
+	} \
+	else { \
+		for (n = index; n < tail; n++) if (a[n] == k) return n; \
+	} \
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Find_Vector(REBSER *vect, REBCNT index, REBCNT tail, REBVAL *arg, REBFLG last, REBFLG sorted)
+/*
+**		Find a number in a vector, from the tail back if last is set.
+**		A sorted (ascending) vector is searched by halves.
+**
+**		Returns the position, or the tail if not found. A number the
+**		vector's type can't hold exactly is not found.
+**
+***********************************************************************/
+{
+	REBCNT type = VECT_TYPE(vect);
+	REBYTE *data = vect->data;
+	REBU64 target = 0; // the number stored as an element (aligned)
+	REBI64 i;
+	REBDEC f;
+	REBCNT n;
+
+	if (IS_INTEGER(arg)) {
+		i = VAL_INT64(arg);
+		f = cast(REBDEC, i);
+	}
+	else if (IS_DECIMAL(arg)) {
+		f = VAL_DECIMAL(arg);
+		i = cast(REBI64, f);
+		if (type < VTSF08 && cast(REBDEC, i) != f) return tail;
+	}
+	else raise Error_Invalid_Arg(arg);
+
+	set_vect(type, cast(REBYTE*, &target), 0, i, f);
+	if (type < VTSF08) {
+		if (get_vect(type, cast(REBYTE*, &target), 0) != cast(REBU64, i))
+			return tail;
+	}
+	else if (Get_Vect_Decimal(type, cast(REBYTE*, &target), 0) != f)
+		return tail;
+
+	switch (type) {
+	case VTSI08: VECT_FIND(i8); break;
+	case VTSI16: VECT_FIND(i16); break;
+	case VTSI32: VECT_FIND(i32); break;
+	case VTSI64: VECT_FIND(i64); break;
+	case VTUI08: VECT_FIND(u8); break;
+	case VTUI16: VECT_FIND(u16); break;
+	case VTUI32: VECT_FIND(u32); break;
+	case VTUI64: VECT_FIND(u64); break;
+	case VTSF32: VECT_FIND(float); break;
+	case VTSF64: VECT_FIND(double); break;
+	}
+
+	return tail;
+}
+
+
 /***********************************************************************
 **
 */	REBTYPE(Vector)
@@ -540,6 +1041,14 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 	REBINT size;
 	REBSER *vect;
 	REBSER *ser;
+	REBCNT args;
+	REBCNT len;
+
+	// Math is element-wise, not the series math of Do_Series_Action:
+	if (action >= A_ADD && action <= A_DIVIDE) {
+		Math_Vector(D_OUT, value, arg, action);
+		return R_OUT;
+	}
 
 	type = Do_Series_Action(call_, action, value, arg);
 	if (type >= 0) return type;
@@ -563,6 +1072,20 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 		return R_ARG3;
 
 	case A_MAKE:
+		// CASE: make vector binary (the bytes as that vector's type)
+		if (IS_VECTOR(value) && IS_BINARY(arg)) {
+			REBCNT wide = SERIES_WIDE(VAL_SERIES(value));
+			len = VAL_LEN(arg);
+			if (len % wide != 0) goto bad_make;
+			type = VECT_TYPE(VAL_SERIES(value));
+			ser = Make_Vector(
+				(type >> 3) & 1, (type >> 2) & 1, 1, bit_sizes[type & 3], len / wide
+			);
+			memcpy(ser->data, VAL_BIN_DATA(arg), len);
+			Val_Init_Vector(value, ser);
+			break;
+		}
+
 		// We only allow MAKE VECTOR! ...
 		if (!IS_DATATYPE(value)) goto bad_make;
 
@@ -602,6 +1125,29 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 		Shuffle_Vector(value, D_REF(3));
 		return R_ARG1;
 
+	case A_FIND:
+		args = Find_Refines(call_, ALL_FIND_REFS);
+		if (args & (AM_FIND_ANY | AM_FIND_WITH | AM_FIND_SKIP | AM_FIND_REVERSE | AM_FIND_MATCH))
+			raise Error_0(RE_BAD_REFINES);
+		len = VAL_TAIL(value);
+		if (args & AM_FIND_PART) {
+			len = Partial1(value, D_ARG(ARG_FIND_LIMIT));
+			len = MIN(VAL_INDEX(value) + len, VAL_TAIL(value));
+		}
+		size = Find_Vector(
+			vect, VAL_INDEX(value), len, arg,
+			args & AM_FIND_LAST, args & AM_FIND_SORTED
+		);
+		if (cast(REBCNT, size) >= len) return R_NONE;
+		VAL_INDEX(value) = size;
+		if (args & AM_FIND_TAIL) VAL_INDEX(value)++;
+		break;
+
+	case A_SORT:
+		if (D_REF(3) || D_REF(5)) raise Error_0(RE_BAD_REFINES); // /skip /compare
+		Sort_Vector(value, Partial(value, 0, D_ARG(8), 0), D_REF(10));
+		break;
+
 	default:
 		raise Error_Illegal_Action(VAL_TYPE(value), action);
 	}
@@ -29,82 +29,245 @@
 #include "sys-core.h"
 #include "sys-zlib.h"
 
+// Output space added each time a stream fills what it was given:
+#define ZSTREAM_CHUNK 0x10000
+
+// Zstream_Feed result when the output passes its limit:
+#define ZSTREAM_OVER_LIMIT (-100)
+
+typedef struct reb_zstream {
+	z_stream strm;
+	REBFLG deflating;
+	REBFLG members;		// gzip inflate: more members may follow one
+	REBFLG at_member;	// ...and one has just ended
+	REBFLG ended;		// Z_STREAM_END was reached
+	REBFLG freed;		// zlib's memory has been released
+} REBZSTREAM;
+
+#define ZSTREAM(s) cast(REBZSTREAM*, BIN_HEAD(s))
+
+
+/***********************************************************************
+**
+*/	ATTRIBUTE_NO_RETURN void Error_Zlib(REBINT err)
 /*
- *  This number represents the top file size that,
- *  if the data is random, will produce a larger output
- *  file than input.  The number is really a bit smaller
- *  but we like to be safe. -- SN
- */
-#define STERLINGS_MAGIC_NUMBER      10000
+**		Raise the error for a zlib result code.
+**
+***********************************************************************/
+{
+	REBVAL arg;
+
+	if (err == Z_MEM_ERROR)
+		raise Error_No_Memory(0); // !!! zlib doesn't say what size
 
+	// !!! Should provide error string descriptions
+	SET_INTEGER(&arg, err);
+	raise Error_1(RE_BAD_PRESS, &arg);
+}
+
+
+/***********************************************************************
+**
+*/	static int Window_Bits(REBCNT format, REBFLG deflating)
 /*
- *  This number represents the largest that a small file that expands
- *  on compression can expand.  The actual value is closer to
- *  500 bytes but why take chances? -- SN
- */
-#define STERLINGS_MAGIC_FIX         1024
+**		The zlib windowBits for a format: ZLIB, GZIP or DEFLATE (raw).
+**		When inflating, ZLIB also accepts a gzip header.
+**
+***********************************************************************/
+{
+	switch (format) {
+	case SYM_GZIP:
+		return MAX_WBITS + 16;
+	case SYM_DEFLATE:
+		return -MAX_WBITS;
+	default:
+		return deflating ? MAX_WBITS : MAX_WBITS + 32;
+	}
+}
 
+
+/***********************************************************************
+**
+*/	REBSER *Make_Zstream(REBFLG deflating, REBCNT format, REBINT level)
 /*
- *  The why_compress_constant is here to satisfy the condition that
- *  somebody might just try compressing some big file that is already well
- *  compressed (or expands for some other wild reason).  So we allocate
- *  a compression buffer a bit larger than the original file size.
- *  10% is overkill for really large files so some other limit might
- *  be a good idea.
-*/
-#define WHY_COMPRESS_CONSTANT       0.1
+**		Make a binary holding the state of a zlib stream, so data can
+**		be passed through it in pieces with Zstream_Feed.
+**
+**		format: SYM_ZLIB, SYM_GZIP or SYM_DEFLATE (raw deflate)
+**		level: 0 (none) to 9 (best), or -1 for zlib's default
+**
+**		Free_Zstream must be called to release zlib's own memory.
+**
+***********************************************************************/
+{
+	REBSER *ser = Make_Binary(sizeof(REBZSTREAM));
+	REBZSTREAM *zs = ZSTREAM(ser);
+	int err;
+
+	CLEAR(zs, sizeof(REBZSTREAM));
+	zs->deflating = deflating;
+	zs->members = !deflating && format == SYM_GZIP;
+
+	if (deflating) {
+		err = deflateInit2(
+			&zs->strm, level, Z_DEFLATED,
+			Window_Bits(format, TRUE), 8, Z_DEFAULT_STRATEGY
+		);
+	}
+	else
+		err = inflateInit2(&zs->strm, Window_Bits(format, FALSE));
+
+	if (err != Z_OK) {
+		Free_Series(ser);
+		raise Error_Zlib(err);
+	}
+
+	return ser;
+}
+
 
 /***********************************************************************
 **
-*/  REBSER *Compress(REBSER *input, REBINT index, REBINT len, REBFLG use_crc)
+*/	REBINT Zstream_Feed(REBSER *ser, const REBYTE *data, REBCNT len, REBFLG finish, REBSER *out, REBCNT limit)
+/*
+**		Pass len bytes through the stream, adding what comes out to
+**		the tail of the out binary (expanded as needed). Finish means
+**		no more data follows: a deflate stream is ended, and an
+**		inflate stream that has not ended is an error.
+**
+**		Returns 1 once the stream has ended, 0 if it expects more,
+**		or a negative zlib error code. The stream is not freed on
+**		error, so the caller can do that before raising it.
+**
+**		A gzip file may be several members one after the other (as
+**		from `cat a.gz b.gz`, pigz or bgzip), so a gzip inflate is
+**		restarted on whatever follows the end of a member.  It only
+**		ends when it is finished between members.
+**
+***********************************************************************/
+{
+	REBZSTREAM *zs = ZSTREAM(ser);
+	z_stream *strm = &zs->strm;
+	REBCNT avail;
+	int err;
+
+	strm->next_in = m_cast(REBYTE*, data);
+	strm->avail_in = len;
+
+	while (!zs->ended) {
+		if (SERIES_AVAIL(out) == 0) Extend_Series(out, ZSTREAM_CHUNK);
+		avail = SERIES_AVAIL(out);
+		strm->next_out = BIN_TAIL(out);
+		strm->avail_out = avail;
+
+		if (zs->deflating)
+			err = deflate(strm, finish ? Z_FINISH : Z_NO_FLUSH);
+		else
+			err = inflate(strm, Z_NO_FLUSH);
+
+		SERIES_TAIL(out) += avail - strm->avail_out;
+
+		if (err == Z_STREAM_END) {
+			if (zs->members) {
+				zs->at_member = TRUE;
+				err = inflateReset(strm);
+				if (err != Z_OK) return err;
+			}
+			else
+				zs->ended = TRUE;
+		}
+		else if (err == Z_BUF_ERROR) break; // no progress possible
+		else if (err != Z_OK) return err;
+		else zs->at_member = FALSE; // into the next member
+
+		if (limit && SERIES_TAIL(out) > limit) return ZSTREAM_OVER_LIMIT;
+
+		// Stop once all input is taken and the output wasn't filled:
+		if (
+			strm->avail_in == 0 && strm->avail_out != 0
+			&& !(finish && zs->deflating)
+		) break;
+	}
+
+	SET_STR_END(out, SERIES_TAIL(out));
+
+	if (finish && zs->at_member) zs->ended = TRUE;
+
+	if (zs->ended) return 1;
+	if (finish) return Z_BUF_ERROR; // inflate data was cut short
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	REBFLG Zstream_Ended(REBSER *ser)
+/*
+***********************************************************************/
+{
+	return ZSTREAM(ser)->ended;
+}
+
+
+/***********************************************************************
+**
+*/	void Free_Zstream(REBSER *ser)
+/*
+**		Release zlib's memory for a stream (the binary stays).
+**
+***********************************************************************/
+{
+	REBZSTREAM *zs = ZSTREAM(ser);
+
+	if (zs->freed) return;
+	if (zs->deflating) deflateEnd(&zs->strm);
+	else inflateEnd(&zs->strm);
+	zs->freed = TRUE;
+}
+
+
+/***********************************************************************
+**
+*/  REBSER *Compress(REBSER *input, REBINT index, REBINT len, REBFLG gzip, REBINT level)
 /*
 **      Compress a binary (only).
 **		data
 **		/part
 **		length
-**		/crc32
+**		/gzip
+**		/level
+**
+**		The output is zlib data followed by the length of the input,
+**		or with gzip a gzip file (which holds the length itself).
 **
-**      Note: If the file length is "small", it can't overrun on
-**      compression too much so we use our magic numbers; otherwise,
-**      we'll just be safe by a percentage of the file size.  This may
-**      be a bit much, though.
+**		It is made the size of zlib's bound for the input, which is
+**		never exceeded, so the data is compressed in one pass.
 **
 ***********************************************************************/
 {
-	// NOTE: The use_crc flag is not present in Zlib 1.2.8
-	// Instead, compress's fifth paramter is the compression level
-	// It can be a value from 1 to 9, or Z_DEFAULT_COMPRESSION if you
-	// want it to pick what the library author considers the "worth it"
-	// tradeoff of time to generally suggest.
-
-	uLongf size;
+	REBSER *zs;
 	REBSER *output;
 	REBINT err;
 	REBYTE out_size[sizeof(REBCNT)];
 
 	if (len < 0) raise Error_0(RE_PAST_END); // !!! better msg needed
-	size = len + (len > STERLINGS_MAGIC_NUMBER ? len / 10 + 12 : STERLINGS_MAGIC_FIX);
-	output = Make_Binary(size);
 
-	// dest, dest-len, src, src-len, level
-	err = z_compress2(BIN_HEAD(output), &size, BIN_HEAD(input) + index, len, Z_DEFAULT_COMPRESSION);
-	if (err) {
-		REBVAL arg;
-		if (err == Z_MEM_ERROR)
-			raise Error_No_Memory(len); // !!! which size goes here?
-		SET_INTEGER(&arg, err);
-		raise Error_1(RE_BAD_PRESS, &arg); //!!!provide error string descriptions
-	}
-	SET_STR_END(output, size);
-	SERIES_TAIL(output) = size;
-	REBCNT_To_Bytes(out_size, (REBCNT)len); // Tag the size to the end.
-	Append_Series(output, (REBYTE*)out_size, sizeof(REBCNT));
-	if (SERIES_AVAIL(output) > 1024) {
-		// Is there wasted space?  Trim it down if too big.
-		// !!! Revisit this based on mem alloc alg.
-		REBSER *smaller = Copy_Sequence(output);
+	zs = Make_Zstream(TRUE, gzip ? SYM_GZIP : SYM_ZLIB, level);
+	output = Make_Binary(
+		cast(REBCNT, deflateBound(&ZSTREAM(zs)->strm, len)) + sizeof(REBCNT)
+	);
+
+	err = Zstream_Feed(zs, BIN_HEAD(input) + index, len, TRUE, output, 0);
+	Free_Zstream(zs);
+	Free_Series(zs);
+	if (err < 0) {
 		Free_Series(output);
-		output = smaller;
+		raise Error_Zlib(err);
+	}
+
+	if (!gzip) {
+		REBCNT_To_Bytes(out_size, (REBCNT)len); // Tag the size to the end.
+		Append_Series(output, (REBYTE*)out_size, sizeof(REBCNT));
 	}
 
 	return output;
@@ -113,20 +276,20 @@
 
 /***********************************************************************
 **
-*/  REBSER *Decompress(const REBYTE *data, REBCNT len, REBCNT limit, REBFLG use_crc)
+*/  REBSER *Decompress(const REBYTE *data, REBCNT len, REBCNT limit, REBFLG gzip)
 /*
 **      Decompress a binary (only).
 **
 **		Rebol's compress/decompress functions store an extra length
-**		at the tail of the data, to double-check the zlib result
+**		at the tail of the data, to double-check the zlib result.
+**		With gzip, the data is a gzip file, whose trailer ends with
+**		the length (modulo 4GB, so it is only used as a size hint).
 **
 ***********************************************************************/
 {
-	// NOTE: The use_crc flag is not present in Zlib 1.2.8
-	// There is no fifth parameter to uncompress matching the fifth to compress
-
-	uLongf size;
+	REBSER *zs;
 	REBSER *output;
+	REBCNT size;
 	REBINT err;
 
 	// Get the size from the end and make the output buffer that size.
@@ -135,29 +298,43 @@
 
 	// NOTE: You can hit this if you 'make prep' without doing a full rebuild
 	// (If you 'make clean' and build again and this goes away, it was that)
-	if (limit && size > limit) {
+	if (limit && size > limit && !gzip) {
 		REBVAL temp;
-		VAL_SET(&temp, size);
+		SET_INTEGER(&temp, size);
 		raise Error_1(RE_SIZE_LIMIT, &temp);
 	}
 
+	// A gzip size can't be trusted for the allocation; deflate
+	// doesn't expand data more than about 1032 times, and no more than
+	// the limit is ever kept:
+	if (gzip && cast(REBU64, size) > cast(REBU64, len) * 1032)
+		size = len * 1032;
+	if (gzip && limit && size > limit)
+		size = limit;
+
+	zs = Make_Zstream(FALSE, gzip ? SYM_GZIP : SYM_ZLIB, 0);
 	output = Make_Binary(size);
 
-	err = z_uncompress(BIN_HEAD(output), &size, data, len);
-	if (err) {
-		REBVAL arg;
+	err = Zstream_Feed(zs, data, len, TRUE, output, limit);
+	Free_Zstream(zs);
+	Free_Series(zs);
 
+	if (err < 0) {
 		Free_Series(output);
 		if (PG_Boot_Phase < BOOT_ERRORS) return 0;
-		if (err == Z_MEM_ERROR)
-			raise Error_No_Memory(size); // !!! is this the size not alloc'd?
-		SET_INTEGER(&arg, err);
+		if (err == ZSTREAM_OVER_LIMIT) {
+			REBVAL temp;
+			SET_INTEGER(&temp, limit);
+			raise Error_1(RE_SIZE_LIMIT, &temp);
+		}
+		raise Error_Zlib(err);
+	}
 
-		// !!! Should provide error string descriptions
-		raise Error_1(RE_BAD_PRESS, &arg);
+	if (!gzip && SERIES_TAIL(output) != size) {
+		Free_Series(output);
+		if (PG_Boot_Phase < BOOT_ERRORS) return 0;
+		raise Error_Zlib(Z_DATA_ERROR);
 	}
-	SET_STR_END(output, size);
-	SERIES_TAIL(output) = size;
 
 	return output;
 }
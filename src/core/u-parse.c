@@ -54,6 +54,24 @@ enum parse_flags {
 
 #define MAX_PARSE_DEPTH 512
 
+// Rule blocks analyzed for alternatives and their leading literals:
+#define PARSE_MEMO_SIZE 64		// keyed by rule head...
+#define PARSE_MEMO_WAYS 2		// ...in sets of this many
+#define PARSE_MEMO_MAX_USES 8	// saturation of the uses count
+#define PARSE_MEMO_MAX_LEN 256	// longer rule blocks are not memoized
+
+typedef struct reb_parse_memo {
+	const REBVAL *rules;	// rule block head (a key, not a GC reference)
+	REBVAL *values;			// copy of the rules as they were analyzed
+	REBCNT len;				// number of rule values
+	REBCNT num_alts;		// number of alternatives (bars + 1), 0 if too long
+	REBCNT uses;			// hits, less misses that found the set full
+	REBCNT num_heads;		// alternatives with a known leading literal
+	REBCNT *alts;			// pairs: start offset, head offset or NOT_FOUND
+} REBPARSE_MEMO;
+
+static REBPARSE_MEMO Parse_Memos[PARSE_MEMO_SIZE];
+
 // Returns SYMBOL or 0 if not a command:
 #define GET_CMD(n) (((n) >= SYM_OR_BAR && (n) <= SYM_END) ? (n) : 0)
 #define VAL_CMD(v) GET_CMD(VAL_WORD_CANON(v))
@@ -128,6 +146,258 @@ void Print_Parse_Index(enum Reb_Kind type, const REBVAL *rules, REBSER *series,
 }
 
 
+/***********************************************************************
+**
+*/	static void Free_Parse_Memo(REBPARSE_MEMO *memo)
+/*
+***********************************************************************/
+{
+	if (!memo->rules) return;
+	if (memo->values) FREE_ARRAY(REBVAL, memo->len, memo->values);
+	if (memo->alts) FREE_ARRAY(REBCNT, 2 * memo->num_alts, memo->alts);
+	CLEARS(memo);
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Find_Parse_Head(const REBVAL *rules, REBCNT start)
+/*
+**		Find the literal that an alternative must match first, if
+**		it has one. Only prefixes that have no effect unless the
+**		match succeeds are passed over: SOME, COPY word, SET word.
+**		Returns the literal's offset or NOT_FOUND.
+**
+***********************************************************************/
+{
+	const REBVAL *item = rules + start;
+	REBCNT cmd;
+
+	while (IS_WORD(item)) {
+		cmd = VAL_CMD(item);
+		if (cmd == SYM_SOME)
+			item++;
+		else if (
+			(cmd == SYM_COPY || cmd == SYM_SET)
+			&& (IS_WORD(item + 1) || IS_SET_WORD(item + 1))
+			&& !VAL_CMD(item + 1)
+		)
+			item += 2;
+		else
+			break;
+	}
+
+	if (IS_CHAR(item) || IS_STRING(item) || IS_BITSET(item))
+		return item - rules;
+
+	return NOT_FOUND;
+}
+
+
+/***********************************************************************
+**
+*/	static REBPARSE_MEMO *Memo_Parse_Rules(const REBVAL *rules)
+/*
+**		Get the analysis of a rule block: where each alternative
+**		starts and which literal it must match first. It is done
+**		once and kept across PARSE calls. The rules may change
+**		after that, so users check them against the copy in the
+**		memo before trusting it.
+**
+**		Returns zero if the block is too long to memoize (which is
+**		remembered too, so it isn't measured again), or if the other
+**		rule blocks in its set are in use.  In that case a memo is
+**		only replaced once the misses have worn down its uses, so
+**		hot blocks that collide don't evict each other on every call.
+**
+***********************************************************************/
+{
+	REBPARSE_MEMO *set;
+	REBPARSE_MEMO *memo = 0;
+	const REBVAL *item;
+	REBCNT len = 0;
+	REBCNT bars = 0;
+	REBCNT n;
+
+	set = &Parse_Memos[
+		((REBUPT)rules / sizeof(REBVAL)) % (PARSE_MEMO_SIZE / PARSE_MEMO_WAYS)
+		* PARSE_MEMO_WAYS
+	];
+
+	for (n = 0; n < PARSE_MEMO_WAYS; n++) {
+		if (set[n].rules == rules) {
+			if (set[n].uses < PARSE_MEMO_MAX_USES) set[n].uses++;
+			return set[n].num_alts > 0 ? &set[n] : 0;
+		}
+		if (!set[n].rules && !memo) memo = &set[n];
+	}
+
+	if (!memo) {
+		for (n = 0; n < PARSE_MEMO_WAYS; n++) {
+			if (set[n].uses > 0) set[n].uses--;
+			if (set[n].uses == 0 && !memo) memo = &set[n];
+		}
+		if (!memo) return 0;
+	}
+
+	Free_Parse_Memo(memo);
+
+	memo->rules = rules;
+	memo->uses = 1;
+
+	for (item = rules; NOT_END(item); item++, len++) {
+		if (len == PARSE_MEMO_MAX_LEN) return 0; // num_alts of 0 says so
+		if (IS_SAME_WORD(item, SYM_OR_BAR)) bars++;
+	}
+
+	memo->len = len;
+	memo->num_alts = bars + 1;
+	memo->alts = ALLOC_ARRAY(REBCNT, 2 * memo->num_alts);
+
+	memo->alts[0] = 0;
+	for (n = 1, item = rules; NOT_END(item); item++) {
+		if (IS_SAME_WORD(item, SYM_OR_BAR))
+			memo->alts[2 * n++] = (item - rules) + 1;
+	}
+
+	for (n = 0; n < memo->num_alts; n++) {
+		memo->alts[2 * n + 1] = Find_Parse_Head(rules, memo->alts[2 * n]);
+		if (memo->alts[2 * n + 1] != NOT_FOUND) memo->num_heads++;
+	}
+
+	// The copy is only compared against, so its series need no GC marking:
+	if (memo->num_heads > 0) {
+		memo->values = ALLOC_ARRAY(REBVAL, len);
+		memcpy(memo->values, rules, len * sizeof(REBVAL));
+	}
+
+	return memo;
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Same_Parse_Rules(const REBVAL *rules, const REBVAL *copy, REBCNT len)
+/*
+**		Are the rules still what was memoized? (Stops at END.)
+**
+***********************************************************************/
+{
+	for (; len > 0; len--, rules++, copy++) {
+		if (IS_END(rules) || memcmp(rules, copy, sizeof(REBVAL)) != 0)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Parse_May_Match(REBPARSE *parse, REBCNT index, const REBVAL *item)
+/*
+**		Could a leading char, string, or bitset match the input at
+**		index? Compares the first char the same way as matching it
+**		in Parse_Next_String would, so FALSE means it surely fails.
+**
+***********************************************************************/
+{
+	REBSER *series = parse->series;
+	REBUNI c1;
+	REBUNI c2;
+
+	if (index >= series->tail) return FALSE;
+
+	c1 = GET_ANY_CHAR(series, index);
+
+	switch (VAL_TYPE(item)) {
+
+	case REB_CHAR:
+		if (HAS_CASE(parse)) return VAL_CHAR(item) == c1;
+		return UP_CASE(VAL_CHAR(item)) == UP_CASE(c1);
+
+	case REB_STRING:
+		if (VAL_LEN(item) == 0) return TRUE;
+		c2 = VAL_ANY_CHAR(item);
+		if (!HAS_CASE(parse)) {
+			if (c1 < UNICODE_CASES) c1 = LO_CASE(c1);
+			if (c2 < UNICODE_CASES) c2 = LO_CASE(c2);
+		}
+		return c1 == c2;
+
+	case REB_BITSET:
+		return Check_Bit(VAL_SERIES(item), c1, !HAS_CASE(parse));
+
+	default:
+		break;
+	}
+
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Skip_Alternatives(REBPARSE *parse, REBCNT index, const REBVAL *rules, REBCNT offset)
+/*
+**		Starting from the alternative at offset in the rules, pass
+**		over the ones whose leading literal can't match the input.
+**		Returns the offset of the alternative to run, or NOT_FOUND
+**		if none of them can match.
+**
+**		An alternative is only passed over after checking that its
+**		rules are unchanged since they were memoized. If they have
+**		changed, the memo is dropped and the rules run as usual.
+**
+***********************************************************************/
+{
+	REBPARSE_MEMO *memo = Memo_Parse_Rules(rules);
+	REBCNT alt;
+	REBCNT start = offset;
+	REBCNT head;
+	REBCNT end;
+
+	if (!memo || memo->num_heads == 0) return offset;
+
+	for (alt = 0; alt < memo->num_alts && memo->alts[2 * alt] < offset; alt++);
+	if (alt == memo->num_alts || memo->alts[2 * alt] != offset) return offset;
+
+	for (; alt < memo->num_alts; alt++) {
+		start = memo->alts[2 * alt];
+		head = memo->alts[2 * alt + 1];
+		if (head == NOT_FOUND) return start;
+
+		if (!Same_Parse_Rules(rules + start, memo->values + start, head + 1 - start))
+			goto changed;
+
+		if (Parse_May_Match(parse, index, rules + head)) return start;
+
+		end = (alt + 1 < memo->num_alts) ? memo->alts[2 * alt + 2] : memo->len;
+		if (!Same_Parse_Rules(rules + head + 1, memo->values + head + 1, end - head - 1))
+			goto changed;
+		if (end == memo->len && NOT_END(rules + end))
+			goto changed;
+	}
+
+	return NOT_FOUND;
+
+changed:
+	Free_Parse_Memo(memo);
+	return start;
+}
+
+
+/***********************************************************************
+**
+*/	void Shutdown_Parse(void)
+/*
+***********************************************************************/
+{
+	REBCNT n;
+
+	for (n = 0; n < PARSE_MEMO_SIZE; n++) Free_Parse_Memo(&Parse_Memos[n]);
+}
+
+
 /***********************************************************************
 **
 */	static REBCNT Parse_Next_String(REBPARSE *parse, REBCNT index, const REBVAL *item, REBCNT depth)
@@ -297,6 +567,92 @@ no_result:
 }
 
 
+/***********************************************************************
+**
+*/	static REBFLG Find_To_Thru_Starts(REBPARSE *parse, const REBVAL *block, REBYTE *starts)
+/*
+**		For TO or THRU a block on string or binary input, mark each
+**		char below 256 that one of the targets could begin with. The
+**		test for each char is the same one To_Thru makes, so input
+**		positions holding an unmarked char can be passed over without
+**		trying the targets.
+**
+**		Returns FALSE if a target's first char can't be known before
+**		the scan (or it is not a valid target, which To_Thru reports).
+**
+***********************************************************************/
+{
+	const REBVAL *blk;
+	const REBVAL *item;
+	REBFLG is_binary = (parse->type == REB_BINARY);
+	REBCNT cmd;
+	REBUNI ch2;
+	REBINT n;
+	REBCNT c;
+
+	CLEAR(starts, 256);
+
+	for (blk = VAL_BLK_HEAD(block); NOT_END(blk); blk++) {
+
+		item = blk;
+
+		if (IS_WORD(item)) {
+			if ((cmd = VAL_CMD(item))) {
+				if (cmd == SYM_END) goto next;
+				if (cmd != SYM_QUOTE) return FALSE;
+				item = ++blk;
+				if (IS_END(item) || IS_PAREN(item)) return FALSE;
+			}
+			else if (!(item = TRY_GET_MUTABLE_VAR(item))) return FALSE;
+		}
+
+		if (IS_INTEGER(item)) {
+			if (VAL_INT64(item) > 0xff) return FALSE;
+			n = VAL_INT32(item);
+			if (n >= 0) starts[n] = 1;
+		}
+		else if (is_binary) {
+			if (IS_CHAR(item)) {
+				if (VAL_CHAR(item) > 0xff) return FALSE;
+				starts[VAL_CHAR(item)] = 1;
+			}
+			else if (IS_BINARY(item))
+				starts[*VAL_BIN_DATA(item)] = 1;
+			else
+				return FALSE;
+		}
+		else if (IS_BITSET(item)) {
+			for (c = 0; c < 256; c++) {
+				if (Check_Bit(VAL_SERIES(item), HAS_CASE(parse) ? c : UP_CASE(c), !HAS_CASE(parse)))
+					starts[c] = 1;
+			}
+		}
+		else if (IS_CHAR(item) || ANY_STR(item)) {
+			ch2 = IS_CHAR(item) ? VAL_CHAR(item) : VAL_ANY_CHAR(item);
+			if (HAS_CASE(parse)) {
+				if (ch2 < 256) starts[ch2] = 1;
+			}
+			else {
+				if (ch2 >= UNICODE_CASES) return FALSE;
+				for (c = 0; c < 256; c++) {
+					if (UP_CASE(c) == UP_CASE(ch2)) starts[c] = 1;
+				}
+			}
+		}
+		else
+			return FALSE;
+
+next:	// Same layout checks as To_Thru:
+		blk++;
+		if (IS_PAREN(blk)) blk++;
+		if (IS_END(blk)) break;
+		if (!IS_OR_BAR(blk)) return FALSE;
+	}
+
+	return TRUE;
+}
+
+
 /***********************************************************************
 **
 */	static REBCNT To_Thru(REBPARSE *parse, REBCNT index, const REBVAL *block, REBFLG is_thru)
@@ -311,9 +667,23 @@ no_result:
 	REBCNT i;
 	REBCNT len;
 	REBVAL save;
+	REBYTE starts[256];
+	REBFLG filter = (type < REB_BLOCK) && Find_To_Thru_Starts(parse, block, starts);
 
 	for (; index <= series->tail; index++) {
 
+		// Pass over chars that no target can begin with:
+		if (filter) {
+			if (BYTE_SIZE(series)) {
+				REBYTE *bp = BIN_HEAD(series);
+				while (index < series->tail && !starts[bp[index]]) index++;
+			}
+			else {
+				REBUNI *up = UNI_HEAD(series);
+				while (index < series->tail && up[index] < 256 && !starts[up[index]]) index++;
+			}
+		}
+
 		for (blk = VAL_BLK_HEAD(block); NOT_END(blk); blk++) {
 
 			item = blk;
@@ -689,6 +1059,13 @@ bad_target:
 	mincount = maxcount = 1;
 	start = begin = index;
 
+	// Pass over alternatives whose leading literal can't match:
+	if (!IS_BLOCK_INPUT(parse) && !Trace_Level) {
+		i = Skip_Alternatives(parse, index, rule_head, 0);
+		if (i == NOT_FOUND) return NOT_FOUND;
+		rules = rule_head + i;
+	}
+
 	// For each rule in the rule block:
 	while (NOT_END(rules)) {
 
@@ -1208,6 +1585,14 @@ post:
 			if (IS_END(rules)) break;
 			rules++;
 			index = begin = start;
+			if (!IS_BLOCK_INPUT(parse) && !Trace_Level) {
+				i = Skip_Alternatives(parse, index, rule_head, rules - rule_head);
+				if (i == NOT_FOUND) {
+					index = NOT_FOUND;
+					break;
+				}
+				rules = rule_head + i;
+			}
 		}
 
 		begin = index;
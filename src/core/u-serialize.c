@@ -0,0 +1,906 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  u-serialize.c
+**  Summary: binary encoding of values
+**  Section: utility
+**  Notes:
+**
+**		SERIALIZE writes a value (and everything it references) as
+**		compact binary that DESERIALIZE can rebuild without going
+**		through MOLD and the scanner.  After a four byte signature,
+**		each value is:
+**
+**			type byte (REB_XXX, high bit set for a new-line before it)
+**			payload, depending on the type
+**
+**		Counts and integers are LEB128 varints (integers zig-zagged),
+**		floating point numbers are their raw IEEE bits, little-endian.
+**
+**		Words name their symbol by its spelling the first time it is
+**		used in the stream and by a small index after that, so a big
+**		block of records doesn't repeat its field names.  Words come
+**		back unbound, as they would from LOAD.
+**
+**		Series are numbered in the order they are first seen.  Each
+**		series value writes 0 and the series content the first time,
+**		and afterward just the number (plus one) of the earlier copy.
+**		This keeps sharing intact (two blocks referencing the same
+**		string still do after a round trip), and cyclic blocks work.
+**		The value's own index follows in either case.
+**
+**		The format depends on the REB_XXX numbering from %types.r,
+**		so it is only meant to be read back by the same version of
+**		the interpreter (the version byte in the signature guards it).
+**
+***********************************************************************/
+
+#include "sys-core.h"
+
+static const REBYTE Serial_Sig[4] = {'R', 'B', 'S', 1};
+
+#define SERIAL_LINE 0x80	// type byte flag for OPT_VALUE_LINE
+
+typedef struct Reb_Serial_Out {
+	REBSER *out;		// binary being written
+	REBSER *series;		// series seen so far (REBSER pointers, by number)
+	REBSER *slots;		// open-addressed table of series numbers + 1
+	REBSER *syms;		// symbol number -> index + 1 in the stream
+	REBCNT num_syms;	// symbols written so far
+} REB_SERIAL_OUT;
+
+typedef struct Reb_Serial_In {
+	const REBYTE *cp;
+	const REBYTE *end;
+	REBSER *series;		// values for the series decoded so far (GC safe)
+	REBSER *syms;		// index in the stream -> symbol number
+} REB_SERIAL_IN;
+
+
+/***********************************************************************
+**
+*/	static void Out_Uint(REB_SERIAL_OUT *so, REBU64 n)
+/*
+***********************************************************************/
+{
+	REBYTE buf[10];
+	REBCNT len = 0;
+
+	do {
+		buf[len] = cast(REBYTE, n & 0x7f);
+		n >>= 7;
+		if (n) buf[len] |= 0x80;
+		len++;
+	} while (n);
+
+	Append_Series(so->out, buf, len);
+}
+
+
+/***********************************************************************
+**
+*/	static void Out_Int(REB_SERIAL_OUT *so, REBI64 n)
+/*
+***********************************************************************/
+{
+	Out_Uint(so, (cast(REBU64, n) << 1) ^ cast(REBU64, n >> 63));
+}
+
+
+/***********************************************************************
+**
+*/	static void Out_Bits(REB_SERIAL_OUT *so, REBU64 bits, REBCNT len)
+/*
+**		Write the low len bytes of bits, little-endian.
+**
+***********************************************************************/
+{
+	REBYTE buf[8];
+	REBCNT n;
+
+	for (n = 0; n < len; n++, bits >>= 8) buf[n] = cast(REBYTE, bits);
+
+	Append_Series(so->out, buf, len);
+}
+
+
+/***********************************************************************
+**
+*/	static void Out_Sym(REB_SERIAL_OUT *so, REBCNT sym)
+/*
+***********************************************************************/
+{
+	REBCNT *ids = cast(REBCNT*, SERIES_DATA(so->syms));
+	const REBYTE *name;
+	REBCNT len;
+
+	assert(sym < SERIES_TAIL(so->syms));
+
+	if (ids[sym]) {
+		Out_Uint(so, ids[sym]);
+		return;
+	}
+
+	ids[sym] = ++so->num_syms;
+
+	name = Get_Sym_Name(sym);
+	len = LEN_BYTES(name);
+	Out_Uint(so, 0);
+	Out_Uint(so, len);
+	Append_Series(so->out, name, len);
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Find_Series_Number(REB_SERIAL_OUT *so, REBSER *ser)
+/*
+**		Return the number + 1 of a series already written, or add
+**		it to the table and return 0 if it's new.
+**
+***********************************************************************/
+{
+	REBCNT *slots = cast(REBCNT*, SERIES_DATA(so->slots));
+	REBSER **seen = cast(REBSER**, SERIES_DATA(so->series));
+	REBCNT mask = SERIES_TAIL(so->slots) - 1;
+	REBCNT n = Mix_Hash(cast(REBU64, cast(REBUPT, ser))) & mask;
+
+	for (; slots[n]; n = (n + 1) & mask) {
+		if (seen[slots[n] - 1] == ser) return slots[n];
+	}
+
+	EXPAND_SERIES_TAIL(so->series, 1);
+	seen = cast(REBSER**, SERIES_DATA(so->series));
+	seen[SERIES_TAIL(so->series) - 1] = ser;
+	slots[n] = SERIES_TAIL(so->series);
+
+	// Keep the table at most half full:
+	if (SERIES_TAIL(so->series) * 2 > mask) {
+		REBCNT size = (mask + 1) * 2;
+		REBCNT i;
+
+		RESIZE_SERIES(so->slots, size);
+		SERIES_TAIL(so->slots) = size;
+		CLEAR(SERIES_DATA(so->slots), size * sizeof(REBCNT));
+		slots = cast(REBCNT*, SERIES_DATA(so->slots));
+		mask = size - 1;
+
+		for (i = 0; i < SERIES_TAIL(so->series); i++) {
+			n = Mix_Hash(cast(REBU64, cast(REBUPT, seen[i]))) & mask;
+			while (slots[n]) n = (n + 1) & mask;
+			slots[n] = i + 1;
+		}
+	}
+
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	static void Serialize_Value_Core(REB_SERIAL_OUT *so, const REBVAL *value)
+/*
+***********************************************************************/
+{
+	REBCNT type = VAL_TYPE(value);
+	REBSER *ser;
+	REBCNT n;
+
+	if (C_STACK_OVERFLOWING(&n)) Trap_Stack_Overflow();
+
+	n = type;
+	if (VAL_GET_OPT(value, OPT_VALUE_LINE)) n |= SERIAL_LINE;
+	Out_Uint(so, n);
+
+	switch (type) {
+
+	case REB_UNSET:
+	case REB_NONE:
+		break;
+
+	case REB_LOGIC:
+		Out_Uint(so, VAL_LOGIC(value) ? 1 : 0);
+		break;
+
+	case REB_INTEGER:
+		Out_Int(so, VAL_INT64(value));
+		break;
+
+	case REB_DECIMAL:
+	case REB_PERCENT: {
+		union {REBDEC d; REBU64 bits;} u;
+		u.d = VAL_DECIMAL(value);
+		Out_Bits(so, u.bits, 8);
+		break;
+	}
+
+	case REB_MONEY: {
+		deci amount = VAL_MONEY_AMOUNT(value);
+		Out_Bits(so, amount.m0, 4);
+		Out_Bits(so, amount.m1, 4);
+		Out_Bits(so, amount.m2 | (cast(REBU64, amount.s) << 23), 4);
+		Out_Bits(so, cast(REBYTE, amount.e), 1);
+		break;
+	}
+
+	case REB_CHAR:
+		Out_Uint(so, VAL_CHAR(value));
+		break;
+
+	case REB_PAIR: {
+		union {REBD32 f; u32 bits;} x, y;
+		x.f = VAL_PAIR_X(value);
+		y.f = VAL_PAIR_Y(value);
+		Out_Bits(so, x.bits, 4);
+		Out_Bits(so, y.bits, 4);
+		break;
+	}
+
+	case REB_TUPLE:
+		Out_Uint(so, VAL_TUPLE_LEN(value));
+		Append_Series(so->out, VAL_TUPLE(value), VAL_TUPLE_LEN(value));
+		break;
+
+	case REB_TIME:
+		Out_Int(so, VAL_TIME(value));
+		break;
+
+	case REB_DATE:
+		Out_Uint(so, VAL_DATE(value).bits);
+		Out_Int(so, VAL_TIME(value));
+		break;
+
+	case REB_DATATYPE:
+		Out_Uint(so, VAL_TYPE_KIND(value));
+		break;
+
+	case REB_TYPESET:
+		Out_Bits(so, VAL_TYPESET_BITS(value), 8);
+		break;
+
+	case REB_WORD:
+	case REB_SET_WORD:
+	case REB_GET_WORD:
+	case REB_LIT_WORD:
+	case REB_REFINEMENT:
+	case REB_ISSUE:
+		Out_Sym(so, VAL_WORD_SYM(value));
+		break;
+
+	case REB_BITSET:
+		ser = VAL_SERIES(value);
+		Out_Uint(so, BITS_NOT(ser) ? 1 : 0);
+		Out_Uint(so, SERIES_TAIL(ser));
+		Append_Series(so->out, BIN_HEAD(ser), SERIES_TAIL(ser));
+		break;
+
+	case REB_BINARY:
+	case REB_STRING:
+	case REB_FILE:
+	case REB_EMAIL:
+	case REB_URL:
+	case REB_TAG:
+		ser = VAL_SERIES(value);
+		n = Find_Series_Number(so, ser);
+		Out_Uint(so, n);
+		if (!n) {
+			Out_Uint(so, SERIES_TAIL(ser));
+			if (BYTE_SIZE(ser)) {
+				Out_Uint(so, 1);
+				Append_Series(so->out, BIN_HEAD(ser), SERIES_TAIL(ser));
+			}
+			else {
+				REBUNI *up = UNI_HEAD(ser);
+				REBYTE *bp;
+				REBCNT len = SERIES_TAIL(ser);
+				REBCNT tail;
+
+				Out_Uint(so, 2);
+				tail = SERIES_TAIL(so->out);
+				EXPAND_SERIES_TAIL(so->out, len * 2);
+				bp = BIN_SKIP(so->out, tail);
+				for (; len > 0; len--, up++) {
+					*bp++ = cast(REBYTE, *up);
+					*bp++ = cast(REBYTE, *up >> 8);
+				}
+				TERM_SERIES(so->out);
+			}
+		}
+		Out_Uint(so, VAL_INDEX(value));
+		break;
+
+	case REB_IMAGE:
+		ser = VAL_SERIES(value);
+		n = Find_Series_Number(so, ser);
+		Out_Uint(so, n);
+		if (!n) {
+			Out_Uint(so, IMG_WIDE(ser));
+			Out_Uint(so, IMG_HIGH(ser));
+			Append_Series(
+				so->out, IMG_DATA(ser), IMG_WIDE(ser) * IMG_HIGH(ser) * 4
+			);
+		}
+		Out_Uint(so, VAL_INDEX(value));
+		break;
+
+	case REB_BLOCK:
+	case REB_PAREN:
+	case REB_PATH:
+	case REB_SET_PATH:
+	case REB_GET_PATH:
+	case REB_LIT_PATH:
+		ser = VAL_SERIES(value);
+		n = Find_Series_Number(so, ser);
+		Out_Uint(so, n);
+		if (!n) {
+			REBCNT i;
+			Out_Uint(so, SERIES_TAIL(ser));
+			for (i = 0; i < SERIES_TAIL(ser); i++)
+				Serialize_Value_Core(so, BLK_SKIP(ser, i));
+		}
+		Out_Uint(so, VAL_INDEX(value));
+		break;
+
+	case REB_MAP:
+		ser = VAL_SERIES(value);
+		n = Find_Series_Number(so, ser);
+		Out_Uint(so, n);
+		if (!n) {
+			REBVAL *val;
+			REBCNT count = 0;
+
+			// Keys set to NONE are removed entries, see %t-map.c
+			for (val = BLK_HEAD(ser); NOT_END(val); val += 2)
+				if (!IS_NONE(val + 1)) count++;
+
+			Out_Uint(so, count);
+			for (val = BLK_HEAD(ser); NOT_END(val); val += 2) {
+				if (IS_NONE(val + 1)) continue;
+				Serialize_Value_Core(so, val);
+				Serialize_Value_Core(so, val + 1);
+			}
+		}
+		break;
+
+	case REB_OBJECT: {
+		REBSER *frame = VAL_OBJ_FRAME(value);
+		REBVAL *key;
+		REBCNT i;
+
+		n = Find_Series_Number(so, frame);
+		Out_Uint(so, n);
+		if (n) break;
+
+		n = 0;
+		key = FRM_KEYS(frame) + 1;
+		for (i = 1; i < SERIES_TAIL(frame); i++, key++)
+			if (!VAL_GET_EXT(key, EXT_WORD_HIDE)) n++;
+
+		Out_Uint(so, n);
+		key = FRM_KEYS(frame) + 1;
+		for (i = 1; i < SERIES_TAIL(frame); i++, key++) {
+			if (VAL_GET_EXT(key, EXT_WORD_HIDE)) continue;
+			Out_Sym(so, VAL_TYPESET_SYM(key));
+			Serialize_Value_Core(so, FRM_VALUE(frame, i));
+		}
+		break;
+	}
+
+	default:
+		// Functions, ports, handles, etc. have no meaning outside of
+		// the running interpreter (same as MOLD/ALL refusing them).
+		raise Error_Has_Bad_Type(value);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Serialize_Value(const REBVAL *value)
+/*
+**		Encode a value and everything it refers to as a binary.
+**		The returned series is not managed.
+**
+***********************************************************************/
+{
+	REB_SERIAL_OUT so;
+
+	so.out = Make_Binary(256);
+	Append_Series(so.out, Serial_Sig, sizeof(Serial_Sig));
+
+	so.series = Make_Series(64, sizeof(REBSER*), MKS_NONE);
+
+	so.slots = Make_Series(128 + 1, sizeof(REBCNT), MKS_NONE);
+	SERIES_TAIL(so.slots) = 128;
+	CLEAR(SERIES_DATA(so.slots), 128 * sizeof(REBCNT));
+
+	so.syms = Make_Series(
+		SERIES_TAIL(PG_Word_Table.series) + 1, sizeof(REBCNT), MKS_NONE
+	);
+	SERIES_TAIL(so.syms) = SERIES_TAIL(PG_Word_Table.series);
+	CLEAR(SERIES_DATA(so.syms), SERIES_TAIL(so.syms) * sizeof(REBCNT));
+	so.num_syms = 0;
+
+	Serialize_Value_Core(&so, value);
+
+	Free_Series(so.syms);
+	Free_Series(so.slots);
+	Free_Series(so.series);
+
+	return so.out;
+}
+
+
+/***********************************************************************
+**
+*/	static REBU64 In_Uint(REB_SERIAL_IN *si)
+/*
+***********************************************************************/
+{
+	REBU64 n = 0;
+	REBCNT shift = 0;
+	REBYTE b;
+
+	do {
+		if (si->cp >= si->end) raise Error_0(RE_PAST_END);
+		if (shift > 63) raise Error_0(RE_BAD_DECODE);
+		b = *si->cp++;
+		n |= cast(REBU64, b & 0x7f) << shift;
+		shift += 7;
+	} while (b & 0x80);
+
+	return n;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT In_Count(REB_SERIAL_IN *si, REBCNT unit)
+/*
+**		Read a count of items that take at least unit bytes each,
+**		so that bad data can't ask for huge allocations.
+**
+***********************************************************************/
+{
+	REBU64 n = In_Uint(si);
+
+	if (n > cast(REBU64, si->end - si->cp) / unit) raise Error_0(RE_PAST_END);
+	return cast(REBCNT, n);
+}
+
+
+/***********************************************************************
+**
+*/	static REBI64 In_Int(REB_SERIAL_IN *si)
+/*
+***********************************************************************/
+{
+	REBU64 n = In_Uint(si);
+	return cast(REBI64, (n >> 1) ^ (0 - (n & 1)));
+}
+
+
+/***********************************************************************
+**
+*/	static REBU64 In_Bits(REB_SERIAL_IN *si, REBCNT len)
+/*
+***********************************************************************/
+{
+	REBU64 bits = 0;
+	REBCNT n;
+
+	if (si->end - si->cp < cast(REBINT, len)) raise Error_0(RE_PAST_END);
+	for (n = 0; n < len; n++) bits |= cast(REBU64, si->cp[n]) << (n * 8);
+	si->cp += len;
+
+	return bits;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT In_Sym(REB_SERIAL_IN *si)
+/*
+***********************************************************************/
+{
+	REBU64 id = In_Uint(si);
+	REBCNT len;
+	REBCNT sym;
+
+	if (id) {
+		if (id > SERIES_TAIL(si->syms)) raise Error_0(RE_BAD_DECODE);
+		return cast(REBCNT*, SERIES_DATA(si->syms))[id - 1];
+	}
+
+	len = In_Count(si, 1);
+	if (len == 0) raise Error_0(RE_BAD_DECODE);
+	sym = Make_Word(si->cp, len);
+	si->cp += len;
+
+	EXPAND_SERIES_TAIL(si->syms, 1);
+	cast(REBCNT*, SERIES_DATA(si->syms))[SERIES_TAIL(si->syms) - 1] = sym;
+
+	return sym;
+}
+
+
+/***********************************************************************
+**
+*/	static REBOOL In_Series_Ref(REB_SERIAL_IN *si, REBVAL *out, REBCNT type)
+/*
+**		If the stream refers back to a series already decoded, set
+**		out to it (with the given type) and return TRUE.  Otherwise
+**		the caller must decode the series and register it.
+**
+***********************************************************************/
+{
+	REBU64 id = In_Uint(si);
+	REBVAL *prior;
+
+	if (!id) return FALSE;
+
+	if (id > SERIES_TAIL(si->series)) raise Error_0(RE_BAD_DECODE);
+	prior = BLK_SKIP(si->series, id - 1);
+
+	// The series must be of the same kind:
+	if (
+		(ANY_BLOCK(prior) != (type >= REB_BLOCK && type <= REB_LIT_PATH))
+		|| (ANY_BINSTR(prior) != (type >= REB_BINARY && type <= REB_TAG))
+		|| (type == REB_BINARY && !VAL_BYTE_SIZE(prior))
+		|| (IS_IMAGE(prior) != (type == REB_IMAGE))
+		|| (IS_MAP(prior) != (type == REB_MAP))
+		|| (IS_OBJECT(prior) != (type == REB_OBJECT))
+	){
+		raise Error_0(RE_BAD_DECODE);
+	}
+
+	*out = *prior;
+	VAL_SET(out, type);
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	static void In_Index(REB_SERIAL_IN *si, REBVAL *out)
+/*
+**		Set the index of a decoded series value, which can't be
+**		past the tail of the series.
+**
+***********************************************************************/
+{
+	REBU64 index = In_Uint(si);
+
+	if (index > SERIES_TAIL(VAL_SERIES(out))) raise Error_0(RE_BAD_DECODE);
+	VAL_INDEX(out) = cast(REBCNT, index);
+}
+
+
+/***********************************************************************
+**
+*/	static void Deserialize_Value_Core(REB_SERIAL_IN *si, REBVAL *out)
+/*
+***********************************************************************/
+{
+	REBCNT n = cast(REBCNT, In_Uint(si));
+	enum Reb_Kind type = cast(enum Reb_Kind, n & ~SERIAL_LINE);
+	REBOOL line = (n & SERIAL_LINE) ? TRUE : FALSE;
+	REBSER *ser;
+	REBCNT len;
+	REBCNT i;
+
+	if (C_STACK_OVERFLOWING(&n)) Trap_Stack_Overflow();
+
+	switch (type) {
+
+	case REB_UNSET:
+	case REB_NONE:
+		VAL_SET(out, type);
+		break;
+
+	case REB_LOGIC:
+		SET_LOGIC(out, In_Uint(si) != 0);
+		break;
+
+	case REB_INTEGER:
+		VAL_SET(out, REB_INTEGER);
+		VAL_INT64(out) = In_Int(si);
+		break;
+
+	case REB_DECIMAL:
+	case REB_PERCENT: {
+		union {REBDEC d; REBU64 bits;} u;
+		u.bits = In_Bits(si, 8);
+		VAL_SET(out, type);
+		VAL_DECIMAL(out) = u.d;
+		break;
+	}
+
+	case REB_MONEY: {
+		deci amount;
+		REBU64 high;
+		amount.m0 = cast(REBCNT, In_Bits(si, 4));
+		amount.m1 = cast(REBCNT, In_Bits(si, 4));
+		high = In_Bits(si, 4);
+		amount.m2 = cast(REBCNT, high & 0x7fffff);
+		amount.s = cast(REBCNT, (high >> 23) & 1);
+		amount.e = cast(signed char, In_Bits(si, 1));
+		SET_MONEY_AMOUNT(out, amount);
+		break;
+	}
+
+	case REB_CHAR:
+		n = cast(REBCNT, In_Uint(si));
+		if (n > MAX_CHAR) raise Error_0(RE_BAD_DECODE);
+		SET_CHAR(out, n);
+		break;
+
+	case REB_PAIR: {
+		union {REBD32 f; u32 bits;} x, y;
+		x.bits = cast(u32, In_Bits(si, 4));
+		y.bits = cast(u32, In_Bits(si, 4));
+		SET_PAIR(out, x.f, y.f);
+		break;
+	}
+
+	case REB_TUPLE:
+		len = In_Count(si, 1);
+		if (len > MAX_TUPLE) raise Error_0(RE_BAD_DECODE);
+		VAL_SET(out, REB_TUPLE);
+		CLEAR(&out->data.tuple, sizeof(out->data.tuple));
+		VAL_TUPLE_LEN(out) = cast(REBYTE, len);
+		memcpy(VAL_TUPLE(out), si->cp, len);
+		si->cp += len;
+		break;
+
+	case REB_TIME:
+		VAL_SET(out, REB_TIME);
+		VAL_TIME(out) = In_Int(si);
+		break;
+
+	case REB_DATE:
+		VAL_SET(out, REB_DATE);
+		VAL_DATE(out).bits = cast(REBCNT, In_Uint(si));
+		VAL_TIME(out) = In_Int(si);
+		break;
+
+	case REB_DATATYPE:
+		n = cast(REBCNT, In_Uint(si));
+		if (n >= REB_MAX) raise Error_0(RE_BAD_DECODE);
+		Val_Init_Datatype(out, n);
+		break;
+
+	case REB_TYPESET:
+		Val_Init_Typeset(out, In_Bits(si, 8), SYM_0);
+		break;
+
+	case REB_WORD:
+	case REB_SET_WORD:
+	case REB_GET_WORD:
+	case REB_LIT_WORD:
+	case REB_REFINEMENT:
+	case REB_ISSUE:
+		Val_Init_Word_Unbound(out, type, In_Sym(si));
+		break;
+
+	case REB_BITSET:
+		n = cast(REBCNT, In_Uint(si));
+		len = In_Count(si, 1);
+		ser = Make_Bitset(len * 8);
+		memcpy(BIN_HEAD(ser), si->cp, len);
+		si->cp += len;
+		BITS_NOT(ser) = n ? 1 : 0;
+		Val_Init_Bitset(out, ser);
+		break;
+
+	case REB_BINARY:
+	case REB_STRING:
+	case REB_FILE:
+	case REB_EMAIL:
+	case REB_URL:
+	case REB_TAG:
+		if (!In_Series_Ref(si, out, type)) {
+			len = In_Count(si, 1);
+			n = cast(REBCNT, In_Uint(si)); // width
+			if (n == 1) {
+				ser = Make_Binary(len);
+				memcpy(BIN_HEAD(ser), si->cp, len);
+				si->cp += len;
+			}
+			else if (n == 2 && type != REB_BINARY) {
+				REBUNI *up;
+				if (len > cast(REBCNT, si->end - si->cp) / 2)
+					raise Error_0(RE_PAST_END);
+				ser = Make_Unicode(len);
+				up = UNI_HEAD(ser);
+				for (i = 0; i < len; i++, si->cp += 2)
+					up[i] = cast(REBUNI, si->cp[0] | (si->cp[1] << 8));
+			}
+			else
+				raise Error_0(RE_BAD_DECODE);
+
+			SERIES_TAIL(ser) = len;
+			TERM_SERIES(ser);
+			Val_Init_Series(out, type, ser);
+			Append_Value(si->series, out);
+		}
+		In_Index(si, out);
+		break;
+
+	case REB_IMAGE:
+		if (!In_Series_Ref(si, out, type)) {
+			REBCNT w = cast(REBCNT, In_Uint(si));
+			REBCNT h = cast(REBCNT, In_Uint(si));
+
+			if (w > 0xFFFF || h > 0xFFFF) raise Error_0(RE_BAD_DECODE);
+			len = w * h * 4;
+			if (len > cast(REBCNT, si->end - si->cp))
+				raise Error_0(RE_PAST_END);
+
+			ser = Make_Image(w, h, TRUE);
+			memcpy(IMG_DATA(ser), si->cp, len);
+			si->cp += len;
+			Val_Init_Image(out, ser);
+			Append_Value(si->series, out);
+		}
+		In_Index(si, out);
+		break;
+
+	case REB_BLOCK:
+	case REB_PAREN:
+	case REB_PATH:
+	case REB_SET_PATH:
+	case REB_GET_PATH:
+	case REB_LIT_PATH:
+		if (!In_Series_Ref(si, out, type)) {
+			REBVAL temp;
+
+			len = In_Count(si, 1);
+			ser = Make_Array(len);
+			for (i = 0; i < len; i++) SET_NONE(BLK_SKIP(ser, i));
+			SET_END(BLK_SKIP(ser, len));
+			SERIES_TAIL(ser) = len;
+			Val_Init_Series(out, type, ser);
+
+			// Register before the contents, which may refer back to it
+			// (with an index checked against the full length):
+			Append_Value(si->series, out);
+
+			for (i = 0; i < len; i++) {
+				Deserialize_Value_Core(si, &temp);
+				*BLK_SKIP(ser, i) = temp;
+			}
+		}
+		In_Index(si, out);
+		break;
+
+	case REB_MAP:
+		if (!In_Series_Ref(si, out, type)) {
+			REBVAL block;
+
+			len = In_Count(si, 2);
+			ser = Make_Array(len * 2);
+			Val_Init_Block(&block, ser);
+			SAVE_SERIES(ser);
+
+			// Register the empty map before its pairs, which may refer
+			// back to it, and add the pairs once they are all decoded:
+			if (!MT_Map(out, &block, REB_MAP)) raise Error_0(RE_BAD_DECODE);
+			Append_Value(si->series, out);
+
+			for (i = 0; i < len * 2; i++) {
+				REBVAL temp;
+				Deserialize_Value_Core(si, &temp);
+				Append_Value(ser, &temp);
+			}
+
+			Append_Map(VAL_SERIES(out), &block, UNKNOWN);
+			UNSAVE_SERIES(ser);
+		}
+		break;
+
+	case REB_OBJECT:
+		if (!In_Series_Ref(si, out, type)) {
+			REBSER *frame;
+
+			len = In_Count(si, 2);
+			frame = Make_Frame(len, TRUE);
+			MANAGE_FRAME(frame);
+			Val_Init_Object(out, frame);
+			Append_Value(si->series, out);
+
+			for (i = 0; i < len; i++) {
+				REBCNT sym = In_Sym(si);
+				REBVAL temp;
+
+				if (Find_Word_Index(frame, sym, TRUE))
+					raise Error_0(RE_BAD_DECODE);
+
+				Deserialize_Value_Core(si, &temp);
+				*Append_Frame(frame, NULL, sym) = temp;
+			}
+		}
+		break;
+
+	default:
+		raise Error_0(RE_BAD_DECODE);
+	}
+
+	if (line) VAL_SET_OPT(out, OPT_VALUE_LINE);
+}
+
+
+/***********************************************************************
+**
+*/	void Deserialize_Value(REBVAL *out, const REBYTE *data, REBCNT len)
+/*
+**		Decode a binary made by Serialize_Value.  All of the data
+**		must be used.  Raises an error if it's not well formed.
+**
+***********************************************************************/
+{
+	REB_SERIAL_IN si;
+
+	if (len < sizeof(Serial_Sig) || memcmp(data, Serial_Sig, sizeof(Serial_Sig)))
+		raise Error_0(RE_BAD_DECODE);
+
+	si.cp = data + sizeof(Serial_Sig);
+	si.end = data + len;
+
+	si.series = Make_Array(64);
+	MANAGE_SERIES(si.series);
+	SAVE_SERIES(si.series);
+
+	si.syms = Make_Series(64, sizeof(REBCNT), MKS_NONE);
+
+	Deserialize_Value_Core(&si, out);
+
+	if (si.cp != si.end) raise Error_0(RE_BAD_DECODE);
+
+	Free_Series(si.syms);
+	UNSAVE_SERIES(si.series);
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(serialize)
+/*
+***********************************************************************/
+{
+	Val_Init_Binary(D_OUT, Serialize_Value(D_ARG(1)));
+	return R_OUT;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(deserialize)
+/*
+***********************************************************************/
+{
+	REBVAL *data = D_ARG(1);
+	REBCNT len = Partial1(data, D_ARG(3));
+
+	Deserialize_Value(D_OUT, VAL_BIN_DATA(data), len);
+
+	return R_OUT;
+}
@@ -175,6 +175,11 @@ Special internal defines used by RT, not Host-Kit developers:
 #ifdef TO_LINUX
 	#define HAS_POSIX_SIGNAL
 
+	// The event device uses epoll to sleep until a socket or serial
+	// handle is ready, instead of sleeping for the full WAIT interval
+	// and then polling every device.  (See %posix/dev-event.c)
+	#define HAS_EPOLL
+
 	// !!! The Atronix build introduced a differentiation between
 	// a Linux build and a POSIX build, and one difference is the
 	// usage of some signal functions that are not available if
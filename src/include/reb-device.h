@@ -87,9 +87,11 @@ enum {
 	// Status flags:
 	RDF_INIT,		// Device is initialized
 	RDF_OPEN,		// Global open (for devs that cannot multi-open)
+	RDF_READY,		// A handle armed with the event device has fired
 	// Options:
 	RDO_MUST_INIT = 16,	// Do not allow auto init (manual init required)
 	RDO_AUTO_POLL,	// Poll device, even if no requests (e.g. interrupts)
+	RDO_EVENT_DRIVEN, // Only poll when RDF_READY (requests armed w/event dev)
 	RDO_MAX
 };
 
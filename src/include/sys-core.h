@@ -902,6 +902,12 @@ typedef struct rebol_word_table
 //	REBCNT	count;		// Number of units used in hash table
 } WORD_TABLE;
 
+// Hash tables are prime sized and open addressed with double hashing.  A
+// mixed hash (see Mix_Hash) picks the first slot and, from its upper bits,
+// a nonzero probe stride; as the size is prime the probe visits every slot.
+#define HASH_SLOT(hash, size)	((hash) % (size))
+#define HASH_SKIP(hash, size)	(1 + ((hash) >> 16) % ((size) - 1))
+
 //-- Measurement Variables:
 typedef struct rebol_stats {
 	REBI64	Series_Memory;
@@ -912,6 +918,10 @@ typedef struct rebol_stats {
 	REBCNT	Recycle_Series_Total;
 	REBCNT	Recycle_Series;
 	REBI64  Recycle_Prior_Eval;
+	REBI64	Recycle_Live_Memory;	// series bytes surviving the last GC
+	REBI64	Recycle_Time;			// total GC pause time (microseconds)
+	REBI64	Recycle_Max_Time;		// longest single GC pause
+	REBI64	Recycle_Last_Time;		// most recent GC pause
 	REBCNT	Mark_Count;
 	REBCNT	Free_List_Checked;
 	REBCNT	Blocks;
@@ -80,6 +80,10 @@ typedef void *REBNOD;			// Just used for linking free nodes
 	REBCNT	units;				// units per segment allocation
 	REBCNT	free;				// number of units remaining
 	REBCNT	has;				// total number of units
+	REBYTE	*bump;				// next never-issued unit in newest segment
+	REBYTE	*bump_end;			// end of newest segment
+	REBCNT	hits;				// allocations served from the free list
+	REBCNT	misses;				// allocations needing fresh segment space
 //	UL		total;				// total bytes for all segs
 //	char	*name;				// identifying string
 //	UL		extra;				// reserved
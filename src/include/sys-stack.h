@@ -240,6 +240,15 @@ struct Reb_Call {
 
 	REBOOL args_ready;	// Function's arguments have finished evaluating
 
+	// Words bound stack-relative to a FUNCTION! need the innermost running
+	// call of that function.  Rather than walk the stack looking for it,
+	// the paramlist keeps a pointer to it (see PARAMLIST_CALL), which is
+	// set when the call is dispatched.  This remembers what the paramlist
+	// pointed to before (an outer recursion, or NULL), and Free_Call()
+	// puts it back.  So relative lookups are O(1) at any recursion depth.
+
+	struct Reb_Call *shadowed;
+
 	REBCNT num_vars;	// !!! Redundant with VAL_FUNC_NUM_PARAMS()?
 
 	REBVAL *out;		// where to write the function's output
@@ -285,6 +294,9 @@ struct Reb_Call {
 
 #define DSF_OUT(c)		((c)->out)
 #define PRIOR_DSF(c)	((c)->prior)
+
+// Innermost running call of the FUNCTION! with this paramlist (or NULL)
+#define PARAMLIST_CALL(p)	((p)->extra.call)
 #define DSF_WHERE(c)	c_cast(const REBVAL*, &(c)->where)
 #define DSF_LABEL(c)	c_cast(const REBVAL*, &(c)->label)
 #define DSF_FUNC(c)		c_cast(const REBVAL*, &(c)->func)
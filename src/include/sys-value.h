@@ -435,6 +435,8 @@ typedef struct Reb_Tuple {
 #endif
 
 
+struct Reb_Call; // see %sys-stack.h
+
 /***********************************************************************
 **
 */	struct Reb_Series
@@ -460,6 +462,7 @@ typedef struct Reb_Tuple {
 	union {
 		REBCNT size;	// used for vectors and bitsets
 		REBSER *series;	// MAP datatype uses this
+		struct Reb_Call *call; // FUNCTION! paramlist: innermost running call
 		struct {
 			REBCNT wide:16;
 			REBCNT high:16;
@@ -703,6 +706,9 @@ struct Reb_Position
 #define Val_Init_Bitset(v,s) \
 	Val_Init_Series((v), REB_BITSET, (s))
 
+// Bitsets keep their "complemented" flag in the series:
+#define BITS_NOT(s) ((s)->extra.size)
+
 #define SET_STR_END(s,n) (*STR_SKIP(s,n) = 0)
 
 // Arg is a binary (byte) series:
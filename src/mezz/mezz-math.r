@@ -66,6 +66,7 @@ minimum-of: func [
 ][
 	size: any [size 1]
 	if 1 > size [cause-error 'script 'out-of-range size]
+	if all [vector? series size = 1] [return extreme-of series]
 	spot: series
 	forskip series size [
 		if lesser? first series first spot [spot: series]
@@ -82,6 +83,7 @@ maximum-of: func [
 ][
 	size: any [size 1]
 	if 1 > size [cause-error 'script 'out-of-range size]
+	if all [vector? series size = 1] [return extreme-of/largest series]
 	spot: series
 	forskip series size [
 		if greater? first series first spot [spot: series]
@@ -98,12 +98,18 @@ save: function [
 
 		unless compress: true? find select header-data 'options 'compress [method: none]
 		save-length: true? select header-data 'length
+		serial: true? find select header-data 'options 'binary
 		header-data: body-of header-data
 	]
 
-	; (Maybe /all should be the default? See CureCode.)
-	data: either all [mold/all/only :value] [mold/only :value]
-	append data newline ; mold does not append a newline? Nope.
+	either serial [
+		; Binary encoding (see SERIALIZE), LOAD decodes it without scanning:
+		data: serialize either block? :value [copy value] [reduce [:value]]
+	][
+		; (Maybe /all should be the default? See CureCode.)
+		data: either all [mold/all/only :value] [mold/only :value]
+		append data newline ; mold does not append a newline? Nope.
+	]
 
 	case/all [
 		; Checksum uncompressed data, if requested
@@ -137,6 +143,8 @@ save: function [
 	probe to string! save/header none data [title: "my code" options: [compress]]
 	probe to string! save/header/compress none data [title: "my code" options: [compress]] none
 	probe to string! save/header none data [title: "my code" checksum: true]
+	probe equal? data load save/header none data [options: [binary]]
+	probe equal? data load save/header/compress none data [options: [binary]] true
 	halt
 	; more needed
 ]
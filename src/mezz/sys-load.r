@@ -93,6 +93,9 @@ load-header: function/with [
 	; Binary vs. script encoded compression will be autodetected. The
 	; header 'checksum is compared to the checksum of the decompressed binary.
 	;
+	; If the 'binary option is set then the body was made by SERIALIZE, and
+	; is returned already decoded as a block (the checksum is of the binary).
+	;
 	; Normally, returns the header object, the body text (as binary), and the
 	; the end of the script or script-in-a-block. The end position can be used
 	; to determine where to stop decoding the body text. After the end is the
@@ -144,6 +147,9 @@ load-header: function/with [
 				all [sum sum != checksum/secure/part rest end] [return 'bad-checksum]
 			]
 		]
+		all [:key = 'rebol find hdr/options 'binary] [ ; SAVE'd as binary, not text
+			rest: either find hdr/options 'compress [deserialize rest] [deserialize/part rest end]
+		]
 		;assert/type [rest [binary!]] none
 		:key != 'rebol [ ; block-embedded script, only script compression, hdr/length ignored
 			tmp: rest ; saved for possible checksum calc later
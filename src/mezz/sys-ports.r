@@ -77,6 +77,14 @@ make-port*: func [
 	port
 ]
 
+read-part*: func [
+	"SYS: Called by native ports to read from a source port."
+	port [port!]
+	size [integer!]
+][
+	read/part port size
+]
+
 *parse-url: make object! [
 	digit:       make bitset! "0123456789"
 	digits:      [1 5 digit]
@@ -288,6 +296,14 @@ init-schemes: func [
 		name: 'clipboard
 	]
 
+	make-scheme [
+		title: "Zlib Compression Stream"
+		name: 'zlib
+		spec: system/standard/port-spec-zlib
+		; CLOSE the port when done: zlib's own memory is not released
+		; if the port is just dropped and garbage collected.
+	]
+
 	if 4 == fourth system/version [
 		make-scheme [
 			title: "Signal"
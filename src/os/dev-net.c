@@ -55,6 +55,11 @@
 void Signal_Device(REBREQ *req, REBINT type);
 DEVICE_CMD Listen_Socket(REBREQ *sock);
 
+#ifdef HAS_EPOLL
+REBOOL Watch_Request(REBREQ *req, int fd, REBOOL out);
+void Unwatch_Fd(int fd);
+#endif
+
 #ifdef TO_WINDOWS
 typedef int socklen_t;
 extern HWND Event_Handle; // For WSAAsync API
@@ -103,6 +108,16 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 #endif
 }
 
+static int Pend_Socket(REBREQ *sock, REBOOL out)
+{
+	// Arm the socket with the event device so the request is polled
+	// again when it is readable (or writable), then report it pending.
+#ifdef HAS_EPOLL
+	Watch_Request(sock, sock->requestee.socket, out);
+#endif
+	return DR_PEND;
+}
+
 
 /***********************************************************************
 **
@@ -119,6 +134,10 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	// Initialize Windows Socket API with given VERSION.
 	// It is ok to call twice, as long as WSACleanup twice.
 	if (WSAStartup(0x0101, &wsaData)) return DR_ERROR;
+#endif
+#ifdef HAS_EPOLL
+	// Every path below that returns DR_PEND goes through Pend_Socket():
+	SET_FLAG(dev->flags, RDO_EVENT_DRIVEN);
 #endif
 	SET_FLAG(dev->flags, RDF_INIT);
 	return DR_DONE;
@@ -251,6 +270,9 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 			sock->requestee.socket = sock->length; // Restore TCP socket (see Lookup)
 		}
 
+#ifdef HAS_EPOLL
+		Unwatch_Fd(sock->requestee.socket);
+#endif
 		if (CLOSE_SOCKET(sock->requestee.socket)) {
 			sock->error = GET_ERROR;
 			return DR_ERROR;
@@ -390,9 +412,9 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	case NE_WOULDBLOCK:
 	case NE_INPROGRESS:
 	case NE_ALREADY:
-		// Still trying:
+		// Still trying (connect completion is reported as writable):
 		SET_FLAG(sock->state, RSM_ATTEMPT);
-		return DR_PEND;
+		return Pend_Socket(sock, TRUE);
 
 	default:
 		// An error happened:
@@ -428,10 +450,19 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 **
 **		Note that the mode flag is cleared by the caller, not here.
 **
+**		Each call moves as much data as the socket will take without
+**		blocking: a send keeps going until everything is written or
+**		the OS buffer is full, and a TCP receive drains the socket
+**		until the read buffer is full or no more data is waiting.
+**		So a burst of input costs one EVT_READ (and one port awake)
+**		instead of one per recv() chunk.  UDP receives remain one
+**		datagram per read, so datagram boundaries are preserved.
+**
 ***********************************************************************/
 {
 	int result;
 	long len;
+	REBOOL progress = FALSE;
 	SOCKAI remote_addr;
 	socklen_t addr_len = sizeof(remote_addr);
 	int mode = (sock->command == RDC_READ ? RSM_RECEIVE : RSM_SEND);
@@ -444,47 +475,60 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 
 	SET_FLAG(sock->state, mode);
 
-	// Limit size of transfer:
-	len = MIN(sock->length - sock->actual, MAX_TRANSFER);
-
 	if (mode == RSM_SEND) {
 		// If host is no longer connected:
 		Set_Addr(&remote_addr, sock->special.net.remote_ip, sock->special.net.remote_port);
-		result = sendto(
-			sock->requestee.socket,
-            s_cast(sock->common.data), len,
-			0, // Flags
-			cast(struct sockaddr*, &remote_addr), addr_len
-		);
-		WATCH2("send() len: %d actual: %d\n", len, result);
-
-		if (result >= 0) {
+
+		do {
+			// Limit size of transfer:
+			len = MIN(sock->length - sock->actual, MAX_TRANSFER);
+			result = sendto(
+				sock->requestee.socket,
+				s_cast(sock->common.data), len,
+				0, // Flags
+				cast(struct sockaddr*, &remote_addr), addr_len
+			);
+			WATCH2("send() len: %d actual: %d\n", len, result);
+
+			if (result < 0) break;
 			sock->common.data += result;
 			sock->actual += result;
-			if (sock->actual >= sock->length) {
-				Signal_Device(sock, EVT_WROTE);
-				return DR_DONE;
-			}
-			SET_FLAG(sock->flags, RRF_ACTIVE); /* notify OS_WAIT of activity */
-			return DR_PEND;
+			progress = TRUE;
+		} while (sock->actual < sock->length);
+
+		if (sock->actual >= sock->length) {
+			Signal_Device(sock, EVT_WROTE);
+			return DR_DONE;
 		}
-		// if (result < 0) ...
+		if (progress)
+			SET_FLAG(sock->flags, RRF_ACTIVE); /* notify OS_WAIT of activity */
+		// (result < 0) ...
 	}
 	else {
-		result = recvfrom(
-			sock->requestee.socket,
-            s_cast(sock->common.data), len,
-			0, // Flags
-			cast(struct sockaddr*, &remote_addr), &addr_len
-		);
-		WATCH2("recv() len: %d result: %d\n", len, result);
-
-		if (result > 0) {
+		// The data is written at common.data + actual, and the caller
+		// advances its buffer tail by actual when the read is done.
+		do {
+			len = sock->length - sock->actual;
+			result = recvfrom(
+				sock->requestee.socket,
+				s_cast(sock->common.data + sock->actual), len,
+				0, // Flags
+				cast(struct sockaddr*, &remote_addr), &addr_len
+			);
+			WATCH2("recv() len: %d result: %d\n", len, result);
+
+			if (result <= 0) break;
+			sock->actual += result;
 			if (GET_FLAG(sock->modes, RST_UDP)) {
 				sock->special.net.remote_ip = remote_addr.sin_addr.s_addr;
 				sock->special.net.remote_port = ntohs(remote_addr.sin_port);
+				break; // one datagram per read
 			}
-			sock->actual = result;
+		} while (sock->actual < sock->length);
+
+		// Deliver what was read.  If the drain stopped on a close or an
+		// error, the next READ will see it again and report it then.
+		if (sock->actual > 0) {
 			Signal_Device(sock, EVT_READ);
 			return DR_DONE;
 		}
@@ -500,7 +544,8 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	// Check error code:
 	result = GET_ERROR;
 	WATCH2("get error: %d %s\n", result, strerror(result));
-	if (result == NE_WOULDBLOCK) return DR_PEND; // still waiting
+	if (result == NE_WOULDBLOCK) // still waiting
+		return Pend_Socket(sock, mode == RSM_SEND);
 
 	WATCH4("ERROR: recv(%d %x) len: %d error: %d\n", sock->requestee.socket, sock->common.data, len, result);
 	// A nasty error happened:
@@ -561,7 +606,7 @@ lserr:
 	Get_Local_IP(sock);
 	sock->command = RDC_CREATE;	// the command done on wakeup
 
-	return DR_PEND;
+	return Pend_Socket(sock, FALSE);
 }
 
 
@@ -594,7 +639,7 @@ lserr:
 
 	if (result == BAD_SOCKET) {
 		result = GET_ERROR;
-		if (result == NE_WOULDBLOCK) return DR_PEND;
+		if (result == NE_WOULDBLOCK) return Pend_Socket(sock, FALSE);
 		sock->error = result;
 		//Signal_Device(sock, EVT_ERROR);
 		return DR_ERROR;
@@ -624,7 +669,7 @@ lserr:
 
 	// Even though we signalled, we keep the listen pending to
 	// accept additional connections.
-	return DR_PEND;
+	return Pend_Socket(sock, FALSE);
 }
 
 /***********************************************************************
@@ -423,6 +423,12 @@ extern void Done_Device(REBUPT handle, int error);
 	for (d = 0; d < RDI_MAX; d++) {
 		dev = Devices[d];
 		if (dev && (dev->pending || GET_FLAG(dev->flags, RDO_AUTO_POLL))) {
+			// Devices whose pending requests are all armed with the
+			// event device only need a visit when one of them fired:
+			if (GET_FLAG(dev->flags, RDO_EVENT_DRIVEN)) {
+				if (!GET_FLAG(dev->flags, RDF_READY)) continue;
+				CLR_FLAG(dev->flags, RDF_READY);
+			}
 			// If there is a custom polling function, use it:
 			if (dev->commands[RDC_POLL]) {
 				if (dev->commands[RDC_POLL]((REBREQ*)dev)) cnt++;
@@ -473,7 +479,8 @@ extern void Done_Device(REBUPT handle, int error);
 /*
 **		Check if devices need attention, and if not, then wait.
 **		The wait can be interrupted by a GUI event, otherwise
-**		the timeout will wake it.
+**		the timeout will wake it.  (On Linux it is also interrupted
+**		when any handle armed with the event device becomes ready.)
 **
 **		Res specifies resolution. (No wait if less than this.)
 **
@@ -49,6 +49,11 @@
 
 extern void Signal_Device(REBREQ *req, REBINT type);
 
+#ifdef HAS_EPOLL
+extern REBOOL Watch_Request(REBREQ *req, int fd, REBOOL out);
+extern void Unwatch_Fd(int fd);
+#endif
+
 #define MAX_SERIAL_PATH 128
 
 /* BXXX constants are defined in termios.h */
@@ -197,6 +202,33 @@ static REBINT Set_Serial_Settings(int ttyfd, REBREQ *req)
 	return 0;
 }
 
+static int Pend_Serial(REBREQ *req, REBOOL out)
+{
+	// Arm the tty with the event device, so WAIT wakes when it has
+	// data (or room for more output) instead of polling it.
+#ifdef HAS_EPOLL
+	Watch_Request(req, req->requestee.id, out);
+#endif
+	return DR_PEND;
+}
+
+
+/***********************************************************************
+**
+*/	DEVICE_CMD Init_Serial(REBREQ *dr)
+/*
+***********************************************************************/
+{
+	REBDEV *dev = (REBDEV*)dr;
+#ifdef HAS_EPOLL
+	// All of the DR_PEND results below go through Pend_Serial():
+	SET_FLAG(dev->flags, RDO_EVENT_DRIVEN);
+#endif
+	SET_FLAG(dev->flags, RDF_INIT);
+	return DR_DONE;
+}
+
+
 /***********************************************************************
 **
 */	DEVICE_CMD Open_Serial(REBREQ *req)
@@ -257,6 +289,9 @@ static REBINT Set_Serial_Settings(int ttyfd, REBREQ *req)
 			TCSANOW,
 			cast(struct termios*, req->special.serial.prior_attr)
 		);
+#ifdef HAS_EPOLL
+		Unwatch_Fd(req->requestee.id);
+#endif
 		close(req->requestee.id);
 		req->requestee.id = 0;
 	}
@@ -281,11 +316,12 @@ static REBINT Set_Serial_Settings(int ttyfd, REBREQ *req)
 	printf("read %d ret: %d\n", req->length, result);
 #endif
 	if (result < 0) {
+		if (errno == EAGAIN) return Pend_Serial(req, FALSE);
 		req->error = -RFE_BAD_READ;
 		Signal_Device(req, EVT_ERROR);
 		return DR_ERROR;
 	} else if (result == 0) {
-		return DR_PEND;
+		return Pend_Serial(req, FALSE);
 	} else {
 		req->actual = result;
 		Signal_Device(req, EVT_READ);
@@ -316,7 +352,7 @@ static REBINT Set_Serial_Settings(int ttyfd, REBREQ *req)
 #endif
 	if (result < 0) {
 		if (errno == EAGAIN) {
-			return DR_PEND;
+			return Pend_Serial(req, TRUE);
 		}
 		req->error = -RFE_BAD_WRITE;
 		Signal_Device(req, EVT_ERROR);
@@ -329,7 +365,7 @@ static REBINT Set_Serial_Settings(int ttyfd, REBREQ *req)
 		return DR_DONE;
 	} else {
 		SET_FLAG(req->flags, RRF_ACTIVE); /* notify OS_WAIT of activity */
-		return DR_PEND;
+		return Pend_Serial(req, TRUE);
 	}
 }
 
@@ -360,7 +396,7 @@ static REBINT Set_Serial_Settings(int ttyfd, REBREQ *req)
 ***********************************************************************/
 
 static DEVICE_CMD_FUNC Dev_Cmds[RDC_MAX] = {
-	0,
+	Init_Serial,
 	0,
 	Open_Serial,
 	Close_Serial,
@@ -40,12 +40,102 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+#include <errno.h>
 #include <sys/time.h>
 
 #include "reb-host.h"
 
+#ifdef HAS_EPOLL
+#include <sys/epoll.h>	// (HAS_EPOLL comes from reb-config.h)
+#endif
+
 extern void Done_Device(REBUPT handle, int error);
 
+#ifdef HAS_EPOLL
+
+extern REBDEV *Devices[];
+
+// Maximum number of readiness notifications taken per epoll_wait().  Any
+// others stay queued in the kernel and are returned on the next wait.
+#define MAX_READY_EVENTS 64
+
+// The epoll instance that socket and serial handles are registered with.
+// It is created on demand, because a device may arm a handle before the
+// event device itself has been initialized by a WAIT.
+static int Reactor_Fd = -1;
+
+
+/***********************************************************************
+**
+*/	static REBOOL Open_Reactor(void)
+/*
+**		Create the epoll instance if it does not exist yet.
+**		Returns FALSE if the kernel refused (caller must poll).
+**
+***********************************************************************/
+{
+	if (Reactor_Fd < 0) Reactor_Fd = epoll_create1(EPOLL_CLOEXEC);
+	return Reactor_Fd >= 0;
+}
+
+
+/***********************************************************************
+**
+*/	REBOOL Watch_Request(REBREQ *req, int fd, REBOOL out)
+/*
+**		Arm a handle so the event device will report when it becomes
+**		readable (or writable, if out is TRUE).  Devices call this
+**		just before returning DR_PEND for a request.
+**
+**		The registration is one-shot: once the handle fires it is
+**		disarmed, and the device re-arms it if the request is still
+**		pending after being polled again.  This avoids spinning on
+**		level-triggered writability of an idle socket.
+**
+**		Only the device number is stored with the handle, never the
+**		request pointer, so a request freed while an event is in
+**		flight cannot be dereferenced.
+**
+**		If the handle cannot be armed, the device is flagged as ready
+**		so that it falls back to being polled on every wait.
+**
+***********************************************************************/
+{
+	struct epoll_event ev;
+
+	CLEARS(&ev);
+	ev.events = (out ? EPOLLOUT : EPOLLIN) | EPOLLONESHOT;
+	ev.data.u32 = req->device;
+
+	if (Open_Reactor()) {
+		if (epoll_ctl(Reactor_Fd, EPOLL_CTL_MOD, fd, &ev) == 0)
+			return TRUE;
+		if (errno == ENOENT && epoll_ctl(Reactor_Fd, EPOLL_CTL_ADD, fd, &ev) == 0)
+			return TRUE;
+	}
+
+	SET_FLAG(Devices[req->device]->flags, RDF_READY);
+	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	void Unwatch_Fd(int fd)
+/*
+**		Remove a handle from the event device before it is closed.
+**		(Closing does this implicitly unless the handle was dup'd,
+**		e.g. inherited by a child process.)
+**
+***********************************************************************/
+{
+	struct epoll_event ev; // ignored, but pre-2.6.9 kernels want non-NULL
+
+	if (Reactor_Fd >= 0) epoll_ctl(Reactor_Fd, EPOLL_CTL_DEL, fd, &ev);
+}
+
+#endif // HAS_EPOLL
+
 /***********************************************************************
 **
 */	DEVICE_CMD Init_Events(REBREQ *dr)
@@ -58,11 +148,36 @@ extern void Done_Device(REBUPT handle, int error);
 ***********************************************************************/
 {
 	REBDEV *dev = (REBDEV*)dr; // just to keep compiler happy
+#ifdef HAS_EPOLL
+	// Failure is not fatal: Query_Events falls back on a timed sleep and
+	// the devices go back to being polled.
+	Open_Reactor();
+#endif
 	SET_FLAG(dev->flags, RDF_INIT);
 	return DR_DONE;
 }
 
 
+/***********************************************************************
+**
+*/	DEVICE_CMD Quit_Events(REBREQ *dr)
+/*
+**		Release the event device resources.
+**
+***********************************************************************/
+{
+	REBDEV *dev = (REBDEV*)dr;
+#ifdef HAS_EPOLL
+	if (Reactor_Fd >= 0) {
+		close(Reactor_Fd);
+		Reactor_Fd = -1;
+	}
+#endif
+	CLR_FLAG(dev->flags, RDF_INIT);
+	return DR_DONE;
+}
+
+
 /***********************************************************************
 **
 */	DEVICE_CMD Poll_Events(REBREQ *req)
@@ -85,11 +200,38 @@ extern void Done_Device(REBUPT handle, int error);
 **		req->length. The latter is used by WAIT as the main timing
 **		method.
 **
+**		With epoll, the wait ends as soon as any armed handle is
+**		ready, and the devices owning those handles are flagged with
+**		RDF_READY so OS_Poll_Devices will visit only them.
+**
 ***********************************************************************/
 {
 	struct timeval tv;
 	int result;
 
+#ifdef HAS_EPOLL
+	if (Reactor_Fd >= 0) {
+		struct epoll_event events[MAX_READY_EVENTS];
+		REBDEV *dev;
+		int n;
+
+		result = epoll_wait(Reactor_Fd, events, MAX_READY_EVENTS, req->length);
+		if (result < 0) {
+			if (errno == EINTR) return DR_DONE; // signal, let caller check
+			req->error = errno;
+			return DR_ERROR;
+		}
+
+		for (n = 0; n < result; n++) {
+			if (events[n].data.u32 >= RDI_MAX) continue;
+			dev = Devices[events[n].data.u32];
+			if (dev) SET_FLAG(dev->flags, RDF_READY);
+		}
+
+		return DR_DONE;
+	}
+#endif
+
 	tv.tv_sec = 0;
 	tv.tv_usec = req->length * 1000;
 	//printf("usec %d\n", tv.tv_usec);
@@ -126,7 +268,7 @@ extern void Done_Device(REBUPT handle, int error);
 
 static DEVICE_CMD_FUNC Dev_Cmds[RDC_MAX] = {
 	Init_Events,			// init device driver resources
-	0,	// RDC_QUIT,		// cleanup device driver resources
+	Quit_Events,			// cleanup device driver resources
 	0,	// RDC_OPEN,		// open device unit (port)
 	0,	// RDC_CLOSE,		// close device unit
 	0,	// RDC_READ,		// read from unit
@@ -76,6 +76,7 @@ core: [
 	p-net.c
 	p-serial.c
 	p-signal.c
+	p-zlib.c
 
 ; Marked as unimplemented
 ;	p-timer.c
@@ -125,6 +126,7 @@ core: [
 	u-md5.c
 	u-parse.c
 	u-png.c
+	u-serialize.c
 	u-sha1.c
 	u-zlib.c
 
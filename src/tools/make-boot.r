@@ -1050,34 +1050,248 @@ boot-ops: load %ops.r
 write %boot-code.r mold reduce sections
 data: mold/flat reduce sections
 insert data reduce ["; Copyright (C) REBOL Technologies " now newline]
+boot-scanned: load/all data ; what Scan_Source will make of the text
 insert tail data make char! 0 ; scanner requires zero termination
+data: to-binary data
 
-comp-data: compress data: to-binary data
+;-- Pre-scanned boot image:
+;
+; The same boot block again, in the binary form written by SERIALIZE (see
+; %u-serialize.c), so that Load_Boot can build it straight from the bytes in
+; the executable instead of inflating and scanning the text on every start.
+; It is made from the loaded text, so it holds what the scanner would have
+; produced: symbols come out in the same order (which the SYM_XXX numbers
+; depend on) and values keep their new-line markers.  If the data has a type
+; this encoder doesn't handle, no image is made and the text is scanned.
+
+image: make binary! length data
+image-syms: make map! 4000
+image-sym-count: 0
+
+img-uint: func [n [integer!]] [
+	while [n > 127] [
+		append image 128 or+ (n and* 127)
+		n: shift n -7
+	]
+	append image n
+]
+
+img-int: func [n [integer!]] [
+	img-uint either n < 0 [(n * -2) - 1] [n * 2]
+]
+
+img-sym: func [value /local spelling id] [
+	spelling: to binary! form to word! :value
+	either id: select image-syms spelling [img-uint id] [
+		image-sym-count: image-sym-count + 1
+		append image-syms reduce [spelling image-sym-count]
+		img-uint 0
+		img-uint length spelling
+		append image spelling
+	]
+]
+
+img-value: func [value line /local type] [
+	type: form type-of :value
+	type: to word! head remove back tail type ; integer! => integer
+	unless find datatypes type [throw false]
+	type: (index-of find datatypes type) - 1 ; REB_XXX
+	img-uint either line [type or+ 128] [type] ; SERIAL_LINE
+	switch/default pick datatypes type + 1 [
+		unset none []
+		logic [append image either :value [1] [0]]
+		integer [img-int value]
+		decimal percent [append image reverse to binary! to decimal! value]
+		char [img-uint to integer! value]
+		tuple [img-uint length value append image to binary! value]
+		time [img-int to integer! round (to decimal! value) * 1e9]
+
+		word set-word get-word lit-word refinement issue [img-sym :value]
+
+		string file email url tag [
+			img-uint 0 ; first (and only) use of this series
+			img-uint length value
+			either (length to binary! value) = length value [
+				img-uint 1 ; all ASCII
+				append image to binary! value
+			][
+				img-uint 2
+				for-each c value [
+					append image (to integer! c) and* 255
+					append image shift to integer! c -8
+				]
+			]
+			img-uint 0 ; index
+		]
+
+		binary [
+			img-uint 0
+			img-uint length value
+			img-uint 1
+			append image value
+			img-uint 0
+		]
+
+		block paren path set-path get-path lit-path [
+			img-uint 0
+			img-uint length value
+			forall value [
+				img-value first value all [
+					any [block? value paren? value]
+					new-line? value
+				]
+			]
+			img-uint 0
+		]
+	][throw false]
+]
+
+;-- Decoder for checking the image:
+;
+; The encoder above restates the C wire format, so decode the image again
+; and make sure it molds back exactly like the scanned text (MOLD shows the
+; new-line markers, so they are checked too).  When the interpreter running
+; this script has DESERIALIZE, the C decoder itself is used for the check.
+
+img-pos: none
+img-spellings: []
+
+img-next-uint: func [/local n bits b] [
+	n: 0
+	bits: 0
+	until [
+		b: first img-pos
+		img-pos: next img-pos
+		n: n or+ shift b and* 127 bits
+		bits: bits + 7
+		b < 128
+	]
+	n
+]
+
+img-next-int: func [/local n] [
+	n: img-next-uint
+	either odd? n [negate (n + 1) / 2] [n / 2]
+]
+
+img-next-bytes: func [len /local bytes] [
+	bytes: copy/part img-pos len
+	img-pos: skip img-pos len
+	bytes
+]
+
+img-next-value: func [
+	"Decode one value and append it to a block"
+	blk [block!]
+	/local n type value len width str id
+][
+	n: img-next-uint
+	type: pick datatypes 1 + (n and* 127)
+	value: switch/default type [
+		none [none]
+		logic [1 = first img-next-bytes 1]
+		integer [img-next-int]
+		decimal percent [
+			value: to decimal! reverse img-next-bytes 8
+			either type = 'percent [to percent! value] [value]
+		]
+		char [to char! img-next-uint]
+		tuple [to tuple! img-next-bytes img-next-uint]
+		time [to time! img-next-int / 1e9]
+
+		word set-word get-word lit-word refinement issue [
+			if zero? id: img-next-uint [
+				append img-spellings to string! img-next-bytes img-next-uint
+				id: length img-spellings
+			]
+			to get to word! join type "!" pick img-spellings id
+		]
+
+		string file email url tag binary [
+			if 0 <> img-next-uint [error "Boot image reuses a series" type]
+			len: img-next-uint
+			width: img-next-uint
+			value: img-next-bytes len * width
+			if type <> 'binary [
+				either width = 1 [value: to string! value] [
+					str: make string! len
+					while [not tail? value] [
+						append str to char! (first value) or+ shift second value 8
+						value: skip value 2
+					]
+					value: str
+				]
+				value: to get to word! join type "!" value
+			]
+			img-next-uint ; index
+			value
+		]
+
+		block paren path set-path get-path lit-path [
+			if 0 <> img-next-uint [error "Boot image reuses a series" type]
+			value: make block! len: img-next-uint
+			loop len [img-next-value value]
+			img-next-uint ; index
+			either type = 'block [value] [to get to word! join type "!" value]
+		]
+	][error "Boot image has unexpected type" type]
+	append/only blk :value
+	if n > 127 [new-line back tail blk true]
+]
+
+append image #{52425301} ; signature, version 1
+either catch [img-value boot-scanned false  true] [
+	either value? 'deserialize [
+		image-decoded: deserialize image
+	][
+		img-pos: skip image 4
+		img-next-value image-decoded: make block! 1
+		image-decoded: first image-decoded
+	]
+	unless strict-equal? mold/all image-decoded mold/all boot-scanned [
+		error "Boot image does not decode to the scanned boot text" ""
+	]
+][
+	print "!!! Boot data can't be pre-scanned, it will be scanned at startup"
+	clear image
+]
+
+;-- Compressed boot text, only needed when there is no image:
+comp-data: either empty? image [compress data] [#{}]
 
 emit [
 {
-// Native_Specs contains data which is the DEFLATE-algorithm-compressed
-// representation of the textual function specs for Rebol's native
-// routines.  Though DEFLATE includes the compressed size in the payload,
-// NAT_UNCOMPRESSED_SIZE is also defined to be used as a sanity check
-// on the decompression process.
+// Boot_Image is the boot block already scanned, encoded as by SERIALIZE.
+// When BOOT_IMAGE_SIZE is zero there is no image, and Native_Specs holds
+// the DEFLATE-compressed text of the boot block to be scanned instead
+// (NAT_UNCOMPRESSED_SIZE is also defined, as a sanity check on inflating).
 }
 newline
 ]
 
-emit ["const REBYTE Native_Specs[NAT_COMPRESSED_SIZE] = {" newline]
-
-;-- Convert UTF-8 binary to C-encoded string:
-emit binary-to-c comp-data
-emit-end/easy
+either empty? image [
+	emit ["const REBYTE Native_Specs[NAT_COMPRESSED_SIZE] = {" newline]
+	emit binary-to-c comp-data ;-- Convert UTF-8 binary to C-encoded string
+	emit-end/easy
+	emit newline
+	emit ["const REBYTE Boot_Image[1] = {0};" newline]
+][
+	emit ["const REBYTE Boot_Image[BOOT_IMAGE_SIZE] = {" newline]
+	emit binary-to-c image
+	emit-end/easy
+]
 
 write src/b-boot.c out
 
 ;-- Output stats:
-print [
-	"Compressed" length data "to" length comp-data "bytes:"
-	to-integer ((length comp-data) / (length data) * 100)
-	"percent of original"
+either empty? image [
+	print [
+		"Compressed" length data "to" length comp-data "bytes:"
+		to-integer ((length comp-data) / (length data) * 100)
+		"percent of original"
+	]
+][
+	print ["Boot image is" length image "bytes"]
 ]
 
 ;-- Create platform string:
@@ -1103,9 +1317,11 @@ emit [
 #define MAX_NATS      } nat-count {
 #define NAT_UNCOMPRESSED_SIZE } length data {
 #define NAT_COMPRESSED_SIZE } length comp-data {
+#define BOOT_IMAGE_SIZE } length image {
 #define CHECK_TITLE   } checksum to binary! title {
 
 extern const REBYTE Native_Specs[];
+extern const REBYTE Boot_Image[];
 extern const REBFUN Native_Funcs[];
 
 typedef struct REBOL_Boot_Block ^{